@@ -2,102 +2,189 @@
 
 #include <JuceHeader.h>
 #include "EuclideanTables.h"
-#include "../Settings/SettingsManager.h"
 
 #ifdef ENABLE_EUCLIDEAN_MODE
 
 /**
  * EuclideanEngine - Generates Euclidean rhythms for each drum voice
- * 
+ *
  * Uses pre-computed lookup tables matching Grids' implementation.
- * Each instrument can have different cycle lengths for polyrhythmic patterns.
+ * Each voice can have a different cycle length for polyrhythmic patterns.
+ *
+ * The engine keeps no playback position: each voice's step is the absolute
+ * step modulo its length, so polymeters stay aligned with the transport.
+ * Length, rotation and hit count are folded into one rotated mask per voice
+ * when they change, so a step is a shift and a mask. Cycles run up to 128
+ * steps; the mask is a multi-word bitset indexed by word, which for cycles
+ * of 32 steps or fewer always lands in the first word. Each voice's accent
+ * mask is built at the same time and stored next to its trigger mask.
  */
 class EuclideanEngine
 {
 public:
-    EuclideanEngine() {
-        loadDefaults();
-    }
+    static constexpr int kMaxVoices = 8;
+    static constexpr int kMaxLength = EuclideanTables::kMaxLongSteps;
     
-    // Reset all step positions to beginning
-    void reset() {
-        step_[0] = step_[1] = step_[2] = 0;
-    }
+    // How hits are spread over a cycle
+    enum class Algorithm {
+        EvenSpread,  // Bresenham spread from the pre-computed table (original Griddy behaviour)
+        Bjorklund    // Bit-exact Bjorklund, starting on a hit like the reference and hardware
+    };
     
-    // Advance all sequences by one step
-    void tick() {
-        for (int i = 0; i < 3; ++i) {
-            if (++step_[i] >= length_[i]) {
-                step_[i] = 0;
-            }
-        }
+    // Which hits are accented
+    enum class AccentMode {
+        None,
+        EveryNth,    // Every Nth hit, starting with the first
+        Nested       // A Euclidean pattern of `value` accents spread over the hits
+    };
+
+    // Starting cycle lengths for BD, SD and HH. The engine reads no settings;
+    // whoever owns it passes the user's defaults in, or sets lengths later.
+    explicit EuclideanEngine(const std::array<int, 3>& drumLengths = { 16, 12, 8 }) {
+        for (int voice = 0; voice < 3; ++voice)
+            setLength(voice, drumLengths[static_cast<size_t>(voice)]);
     }
-    
-    // Check if an instrument should trigger based on density
-    bool shouldTrigger(int instrument, float density) {
-        if (instrument < 0 || instrument >= 3) return false;
-        
-        // Convert density (0-1) to number of hits in the pattern
-        int hits = static_cast<int>(density * length_[instrument] + 0.5f);
-        
-        // Get the pattern for this length/hits combination
-        uint32_t pattern = EuclideanTables::getPattern(length_[instrument], hits);
-        
-        // Check if current step should trigger
-        return EuclideanTables::shouldTrigger(pattern, step_[instrument]);
+
+    // Setters return true when the pattern changed
+    bool setLength(int voice, int length) {
+        if (!isValidVoice(voice)) return false;
+        return update(voice, length_[voice], static_cast<uint8_t>(juce::jlimit(1, kMaxLength, length)));
     }
+
+    bool setRotation(int voice, int rotation) {
+        if (!isValidVoice(voice)) return false;
+        return update(voice, rotation_[voice], static_cast<uint8_t>(juce::jlimit(0, kMaxLength - 1, rotation)));
+    }
+
+    bool setAlgorithm(Algorithm algorithm) {
+        if (algorithm == algorithm_) return false;
+        algorithm_ = algorithm;
+        bool changed = false;
+        for (int voice = 0; voice < kMaxVoices; ++voice)
+            changed = rebuild(voice) || changed;
+        return changed;
+    }
+    Algorithm getAlgorithm() const { return algorithm_; }
     
-    // Set the cycle length for an instrument
-    void setLength(int instrument, uint8_t length) {
-        if (instrument < 0 || instrument >= 3) return;
-        
-        length_[instrument] = juce::jlimit(uint8_t(1), uint8_t(32), length);
+    // Accent sub-pattern; `value` is N for EveryNth, or the number of accents for Nested
+    bool setAccent(int voice, AccentMode mode, int value) {
+        if (!isValidVoice(voice)) return false;
+        const auto clamped = static_cast<uint8_t>(juce::jlimit(1, kMaxLength, value));
+        if (mode == accentModes_[voice] && clamped == accentValues_[voice]) return false;
         
-        // Reset step position if it's beyond new length
-        if (step_[instrument] >= length_[instrument]) {
-            step_[instrument] = 0;
-        }
+        accentModes_[voice] = mode;
+        accentValues_[voice] = clamped;
+        return rebuild(voice);
     }
     
-    // Get the cycle length for an instrument
-    uint8_t getLength(int instrument) const {
-        if (instrument < 0 || instrument >= 3) return 16;
-        return length_[instrument];
+    // Hits are density * length, rounded - worked out here, not on every step
+    bool setDensity(int voice, float density) {
+        if (!isValidVoice(voice)) return false;
+        if (density == density_[voice]) return false;
+
+        density_[voice] = density;
+        return rebuild(voice);
     }
-    
-    // Get current step position for an instrument
-    uint8_t getStep(int instrument) const {
-        if (instrument < 0 || instrument >= 3) return 0;
-        return step_[instrument];
+
+    int getLength(int voice) const { return isValidVoice(voice) ? length_[voice] : 16; }
+    int getRotation(int voice) const { return isValidVoice(voice) ? rotation_[voice] : 0; }
+    int getHits(int voice) const { return isValidVoice(voice) ? hits_[voice] : 0; }
+
+    // Whether a voice fires at an absolute step (its own step is absoluteStep mod length)
+    bool getTrigger(int voice, int64_t absoluteStep) const {
+        const int64_t length = length_[voice];
+        const auto step = static_cast<int>(((absoluteStep % length) + length) % length);
+        return masks_[voice].triggers.test(step);
     }
     
-    // Load default lengths from global settings
-    void loadDefaults() {
-        auto& settings = SettingsManager::getInstance();
-        length_[0] = static_cast<uint8_t>(settings.getInt(SettingsManager::Keys::euclideanBDLength, 16));
-        length_[1] = static_cast<uint8_t>(settings.getInt(SettingsManager::Keys::euclideanSDLength, 12));
-        length_[2] = static_cast<uint8_t>(settings.getInt(SettingsManager::Keys::euclideanHHLength, 8));
+    // Whether a voice's hit at an absolute step is accented
+    bool getAccent(int voice, int64_t absoluteStep) const {
+        const int64_t length = length_[voice];
+        const auto step = static_cast<int>(((absoluteStep % length) + length) % length);
+        return masks_[voice].accents.test(step);
     }
-    
-    // Save current lengths to global settings
-    void saveToSettings() {
-        auto& settings = SettingsManager::getInstance();
-        settings.setInt(SettingsManager::Keys::euclideanBDLength, length_[0]);
-        settings.setInt(SettingsManager::Keys::euclideanSDLength, length_[1]);
-        settings.setInt(SettingsManager::Keys::euclideanHHLength, length_[2]);
+
+    // Rotated pattern over the voice's length (bit i = step i)
+    EuclideanTables::PatternBits getPattern(int voice) const {
+        return isValidVoice(voice) ? masks_[voice].triggers : EuclideanTables::PatternBits {};
+    }
+
+    // Triggers or accents for the 32 steps starting at an absolute step (bit i =
+    // firstStep + i), wrapping the cycle - what a 32-step display shows there
+    uint32_t getWindow(int voice, int64_t firstStep) const {
+        return isValidVoice(voice) ? unroll(masks_[voice].triggers, length_[voice], firstStep) : 0;
+    }
+    uint32_t getAccentWindow(int voice, int64_t firstStep) const {
+        return isValidVoice(voice) ? unroll(masks_[voice].accents, length_[voice], firstStep) : 0;
+    }
+
+private:
+    static bool isValidVoice(int voice) { return voice >= 0 && voice < kMaxVoices; }
+
+    // A new length or rotation always counts as a change: the same bits over a
+    // different cycle still play differently
+    bool update(int voice, uint8_t& field, uint8_t value) {
+        if (field == value) return false;
+        field = value;
+        rebuild(voice);
+        return true;
     }
     
-    // Get pattern visualization for UI
-    uint32_t getPattern(int instrument, float density) const {
-        if (instrument < 0 || instrument >= 3) return 0;
+    static uint32_t unroll(const EuclideanTables::PatternBits& bits, int64_t length, int64_t firstStep) {
+        auto step = static_cast<int>(((firstStep % length) + length) % length);
+        uint32_t window = 0;
+        for (int i = 0; i < 32; ++i) {
+            window |= (bits.test(step) ? 1u : 0u) << i;
+            if (++step == length) step = 0;
+        }
+        return window;
+    }
+
+    // Recompute a voice's masks. Returns true if its triggers or accents changed
+    bool rebuild(int voice) {
+        const int length = length_[voice];
+        const int hits = juce::jlimit(0, length, static_cast<int>(density_[voice] * length + 0.5f));
+        const int rotation = rotation_[voice] % length;
+        hits_[voice] = static_cast<uint8_t>(hits);
+        
+        // Rotated later by `rotation` steps within the cycle (a table load up to 32 steps)
+        const bool bjorklund = algorithm_ == Algorithm::Bjorklund;
+        VoiceMasks masks;
+        masks.triggers = bjorklund ? EuclideanTables::getBjorklundBits(length, hits, rotation)
+                                   : EuclideanTables::getPatternBits(length, hits, rotation);
         
-        int hits = static_cast<int>(density * length_[instrument] + 0.5f);
-        return EuclideanTables::getPattern(length_[instrument], hits);
+        // Accents are picked from the unrotated hits and rotated with them
+        if (accentModes_[voice] != AccentMode::None && hits > 0) {
+            const int value = accentValues_[voice];
+            const auto accentHits = accentModes_[voice] == AccentMode::EveryNth
+                ? EuclideanTables::everyNthHit(hits, value)
+                : (bjorklund ? EuclideanTables::getBjorklundBits(hits, value, 0)
+                             : EuclideanTables::getPatternBits(hits, value, 0));
+            const auto unrotated = bjorklund ? EuclideanTables::getBjorklundBits(length, hits, 0)
+                                             : EuclideanTables::getPatternBits(length, hits, 0);
+            masks.accents = EuclideanTables::rotateBits(EuclideanTables::depositAccents(unrotated, length, accentHits),
+                                                        length, rotation);
+        }
+        
+        const bool changed = masks.triggers != masks_[voice].triggers || masks.accents != masks_[voice].accents;
+        masks_[voice] = masks;
+        return changed;
     }
     
-private:
-    uint8_t step_[3] = {0, 0, 0};         // Current step for each instrument
-    uint8_t length_[3] = {16, 12, 8};     // Cycle length for each instrument
+    // A voice's triggers and accents side by side, so a step touches one cache line
+    struct VoiceMasks {
+        EuclideanTables::PatternBits triggers;
+        EuclideanTables::PatternBits accents;
+    };
+
+    std::array<uint8_t, kMaxVoices> length_ { 16, 12, 8, 16, 16, 16, 16, 16 };
+    std::array<uint8_t, kMaxVoices> rotation_ {};
+    std::array<uint8_t, kMaxVoices> hits_ {};
+    std::array<float, kMaxVoices> density_ {};
+    std::array<AccentMode, kMaxVoices> accentModes_ {};
+    std::array<uint8_t, kMaxVoices> accentValues_ { 2, 2, 2, 2, 2, 2, 2, 2 };
+    Algorithm algorithm_ = Algorithm::EvenSpread;
+    std::array<VoiceMasks, kMaxVoices> masks_ {};
 };
 
-#endif // ENABLE_EUCLIDEAN_MODE
\ No newline at end of file
+#endif // ENABLE_EUCLIDEAN_MODE
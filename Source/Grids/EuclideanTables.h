@@ -1,76 +1,351 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
 #ifdef ENABLE_EUCLIDEAN_MODE
 
 namespace EuclideanTables {
-    
+
     /**
-     * Pre-computed Euclidean patterns using Björklund's algorithm
+     * Pre-computed Euclidean patterns, generated at compile time into read-only data
      * Matching Grids' implementation for consistency
-     * 
-     * Each pattern is a 32-bit value where bit i indicates if step i should trigger
+     *
+     * Each pattern is a 32-bit value where bit i indicates if step i should trigger.
+     * Rotated variants are tabulated too, so a rotated pattern is a single load.
+     * Longer cycles (up to 128 steps) are spread into a multi-word PatternBits
+     * when a voice changes, using the same spread as the table. A second table
+     * holds the bit-exact Bjorklund patterns, and accents are derived from the
+     * hits of either as a sub-pattern (every Nth hit, or a nested Euclidean).
      */
-    
+
+    constexpr int kMaxSteps = 32;
+    constexpr int kMaxLongSteps = 128;
+    constexpr int kPatternWords = kMaxLongSteps / 32;
+
+    constexpr uint32_t stepMask(int steps) {
+        return steps >= 32 ? 0xFFFFFFFFu : (1u << steps) - 1u;
+    }
+
     // Helper to generate Euclidean patterns
-    inline uint32_t computeEuclideanPattern(int hits, int steps) {
+    constexpr uint32_t computeEuclideanPattern(int hits, int steps) {
         if (hits >= steps) return 0xFFFFFFFF; // All hits
         if (hits == 0) return 0; // No hits
-        
+
         uint32_t pattern = 0;
         int bucket = 0;
-        
+
         // Bresenham-like algorithm for even distribution
         for (int i = 0; i < steps; ++i) {
             bucket += hits;
             if (bucket >= steps) {
                 bucket -= steps;
-                pattern |= (1 << i);
+                pattern |= (1u << i);
             }
         }
-        
+
         return pattern;
     }
-    
-    // Generate lookup table at compile time
-    // Indexed by [steps][hits] where steps is 1-32 and hits is 0-steps
-    class PatternTable {
-    public:
-        PatternTable() {
-            for (int steps = 1; steps <= 32; ++steps) {
-                for (int hits = 0; hits <= steps; ++hits) {
-                    patterns_[steps - 1][hits] = computeEuclideanPattern(hits, steps);
-                }
-            }
+
+    // Rotate a pattern later by `rotation` steps within its cycle
+    constexpr uint32_t rotatePattern(uint32_t pattern, int steps, int rotation) {
+        pattern &= stepMask(steps);
+        rotation %= steps;
+        if (rotation == 0) return pattern;
+        return ((pattern << rotation) | (pattern >> (steps - rotation))) & stepMask(steps);
+    }
+
+    // Indexed by [steps - 1][hits] where steps is 1-32 and hits is 0-steps
+    using PatternTable = std::array<std::array<uint32_t, kMaxSteps + 1>, kMaxSteps>;
+
+    // Indexed by [steps - 1][hits][rotation], rotation 0-31 (taken modulo steps)
+    using RotationTable = std::array<std::array<std::array<uint32_t, kMaxSteps>, kMaxSteps + 1>, kMaxSteps>;
+
+    constexpr PatternTable makePatternTable() {
+        PatternTable table {};
+        for (int steps = 1; steps <= kMaxSteps; ++steps)
+            for (int hits = 0; hits <= steps; ++hits)
+                table[steps - 1][hits] = computeEuclideanPattern(hits, steps);
+        return table;
+    }
+
+    constexpr PatternTable kPatterns = makePatternTable();
+
+    constexpr RotationTable makeRotationTable() {
+        RotationTable table {};
+        for (int steps = 1; steps <= kMaxSteps; ++steps)
+            for (int hits = 0; hits <= steps; ++hits)
+                for (int rotation = 0; rotation < kMaxSteps; ++rotation)
+                    table[steps - 1][hits][rotation] = rotatePattern(kPatterns[steps - 1][hits], steps, rotation);
+        return table;
+    }
+
+    constexpr RotationTable kRotatedPatterns = makeRotationTable();
+
+    // Convenience function to get a pattern
+    constexpr uint32_t getPattern(int steps, int hits) {
+        if (steps < 1 || steps > kMaxSteps) return 0;
+        if (hits < 0) return 0;
+        if (hits > steps) return 0xFFFFFFFF;
+        return kPatterns[steps - 1][hits];
+    }
+
+    // Pattern rotated later by `rotation` steps, masked to its cycle
+    constexpr uint32_t getRotatedPattern(int steps, int hits, int rotation) {
+        if (steps < 1 || steps > kMaxSteps) return 0;
+        if (hits < 0) return 0;
+        if (hits > steps) return stepMask(steps);
+        return kRotatedPatterns[steps - 1][hits][static_cast<unsigned>(rotation) % kMaxSteps];
+    }
+
+    // Whether step i of `steps` is a hit - the table's spread without the running bucket
+    constexpr bool isSpreadHit(int step, int steps, int hits) {
+        return ((step + 1) * hits) / steps != (step * hits) / steps;
+    }
+
+    // A pattern of up to 128 steps, 32 per word (bit i of word w = step 32 * w + i)
+    struct PatternBits {
+        std::array<uint32_t, kPatternWords> words {};
+
+        // Word indexing keeps this constant-time; patterns of 32 steps or fewer only use word 0
+        constexpr bool test(int step) const {
+            return (words[static_cast<std::size_t>(step >> 5)] >> (step & 31)) & 1u;
         }
-        
-        uint32_t getPattern(int steps, int hits) const {
-            if (steps < 1 || steps > 32) return 0;
-            if (hits < 0) return 0;
-            if (hits > steps) return 0xFFFFFFFF;
-            return patterns_[steps - 1][hits];
+        constexpr void set(int step) {
+            words[static_cast<std::size_t>(step >> 5)] |= 1u << (step & 31);
+        }
+        constexpr bool operator==(const PatternBits& other) const {
+            for (int word = 0; word < kPatternWords; ++word)
+                if (words[static_cast<std::size_t>(word)] != other.words[static_cast<std::size_t>(word)]) return false;
+            return true;
+        }
+        constexpr bool operator!=(const PatternBits& other) const { return !(*this == other); }
+    };
+
+    // Pattern of any length up to 128, rotated later by `rotation` steps. Up to 32 steps
+    // this is the table entry; longer cycles are spread here, one pass over the steps
+    constexpr PatternBits getPatternBits(int steps, int hits, int rotation) {
+        PatternBits bits;
+        if (steps < 1 || steps > kMaxLongSteps) return bits;
+        if (steps <= kMaxSteps) {
+            bits.words[0] = getRotatedPattern(steps, hits, rotation);
+            return bits;
+        }
+
+        hits = hits < 0 ? 0 : (hits > steps ? steps : hits);
+        rotation = ((rotation % steps) + steps) % steps;
+        for (int step = 0; step < steps; ++step)
+            if (isSpreadHit(step, steps, hits))
+                bits.set((step + rotation) % steps);
+        return bits;
+    }
+
+    // Rotate any pattern later by `rotation` steps within its cycle
+    constexpr PatternBits rotateBits(const PatternBits& bits, int steps, int rotation) {
+        if (steps <= kMaxSteps) {
+            PatternBits rotated;
+            rotated.words[0] = rotatePattern(bits.words[0], steps, rotation);
+            return rotated;
+        }
+
+        rotation = ((rotation % steps) + steps) % steps;
+        PatternBits rotated;
+        for (int step = 0; step < steps; ++step)
+            if (bits.test(step))
+                rotated.set((step + rotation) % steps);
+        return rotated;
+    }
+
+    //==========================================================================
+    // Bjorklund's algorithm, bit-exact with the reference implementation (and
+    // the hardware tables built from it): the pattern starts on a hit, so step
+    // 0 of an unrotated pattern always sounds. The table's even spread gives
+    // the same patterns up to rotation.
+    struct BjorklundBuilder {
+        int counts[kMaxLongSteps + 1] {};
+        int remainders[kMaxLongSteps + 1] {};
+        PatternBits pattern {};
+        int length = 0;
+
+        constexpr void build(int level) {
+            if (level == -1) {
+                ++length;                   // Rest
+            } else if (level == -2) {
+                pattern.set(length++);      // Hit
+            } else {
+                for (int i = 0; i < counts[level]; ++i)
+                    build(level - 1);
+                if (remainders[level] != 0)
+                    build(level - 2);
+            }
         }
-        
-    private:
-        uint32_t patterns_[32][33]; // [steps-1][hits]
     };
-    
-    // Static instance for global access
-    inline const PatternTable& getPatternTable() {
-        static PatternTable table;
+
+    constexpr PatternBits computeBjorklundPattern(int hits, int steps) {
+        PatternBits bits;
+        if (steps < 1 || steps > kMaxLongSteps || hits <= 0) return bits;
+        if (hits >= steps) {
+            for (int step = 0; step < steps; ++step) bits.set(step);
+            return bits;
+        }
+
+        BjorklundBuilder b;
+        int divisor = steps - hits;
+        b.remainders[0] = hits;
+        int level = 0;
+        do {
+            b.counts[level] = divisor / b.remainders[level];
+            b.remainders[level + 1] = divisor % b.remainders[level];
+            divisor = b.remainders[level];
+            ++level;
+        } while (b.remainders[level] > 1);
+        b.counts[level] = divisor;
+        b.build(level);
+
+        // Start on the first hit, as the reference implementation does
+        int first = 0;
+        while (!b.pattern.test(first)) ++first;
+        return rotateBits(b.pattern, steps, steps - first);
+    }
+
+    // Indexed by [steps - 1][hits], like kPatterns
+    constexpr PatternTable makeBjorklundTable() {
+        PatternTable table {};
+        for (int steps = 1; steps <= kMaxSteps; ++steps)
+            for (int hits = 0; hits <= steps; ++hits)
+                table[steps - 1][hits] = computeBjorklundPattern(hits, steps).words[0];
         return table;
     }
-    
-    // Convenience function to get a pattern
-    inline uint32_t getPattern(int steps, int hits) {
-        return getPatternTable().getPattern(steps, hits);
+
+    constexpr PatternTable kBjorklundPatterns = makeBjorklundTable();
+
+    constexpr uint32_t getBjorklundPattern(int steps, int hits) {
+        if (steps < 1 || steps > kMaxSteps) return 0;
+        if (hits < 0) return 0;
+        if (hits > steps) return stepMask(steps);
+        return kBjorklundPatterns[steps - 1][hits];
+    }
+
+    // Bjorklund pattern of any length up to 128, rotated later by `rotation` steps
+    constexpr PatternBits getBjorklundBits(int steps, int hits, int rotation) {
+        if (steps <= kMaxSteps) {
+            PatternBits bits;
+            bits.words[0] = rotatePattern(getBjorklundPattern(steps, hits), steps, rotation);
+            return bits;
+        }
+        return rotateBits(computeBjorklundPattern(hits, steps), steps, rotation);
+    }
+
+    //==========================================================================
+    // Accents as a sub-pattern of the hits: hit k of a cycle (counting from
+    // step 0) is accented when bit k of `accentHits` is set. Accents are worked
+    // out on the unrotated pattern and rotated with it, so they follow their hits
+    constexpr PatternBits depositAccents(const PatternBits& triggers, int steps, const PatternBits& accentHits) {
+        PatternBits accents;
+        int hit = 0;
+        for (int step = 0; step < steps; ++step) {
+            if (!triggers.test(step)) continue;
+            if (accentHits.test(hit)) accents.set(step);
+            ++hit;
+        }
+        return accents;
+    }
+
+    // Every Nth hit, starting with the first
+    constexpr PatternBits everyNthHit(int hits, int n) {
+        PatternBits bits;
+        if (n < 1) return bits;
+        for (int hit = 0; hit < hits; hit += n) bits.set(hit);
+        return bits;
     }
-    
+
     // Check if a step should trigger based on pattern
     inline bool shouldTrigger(uint32_t pattern, int step) {
         return (pattern >> (step % 32)) & 1;
     }
+
+    inline bool shouldTrigger(const PatternBits& pattern, int step) {
+        return pattern.test(step % kMaxLongSteps);
+    }
+
+    //==========================================================================
+    // Compile-time checks against Bjorklund's algorithm. The table's even spread
+    // starts at a different point than Bjorklund's, and no single offset lines the
+    // two up for every steps/hits pair, so both are compared in canonical form: the
+    // rotation whose mask is numerically smallest. That picks one rotation per
+    // pattern, so the comparison is an exact equality rather than a search.
+    // Bjorklund's own patterns are checked exactly: each starts on a hit, has its
+    // hit count, and the well-known rhythms below are pinned bit for bit
+    namespace Verification {
+
+        constexpr uint32_t canonicalRotation(uint32_t pattern, int steps) {
+            uint32_t smallest = pattern & stepMask(steps);
+            for (int rotation = 1; rotation < steps; ++rotation) {
+                const uint32_t rotated = rotatePattern(pattern, steps, rotation) & stepMask(steps);
+                if (rotated < smallest) smallest = rotated;
+            }
+            return smallest;
+        }
+
+        constexpr int countBits(uint32_t pattern) {
+            int count = 0;
+            for (; pattern != 0; pattern &= pattern - 1) ++count;
+            return count;
+        }
+
+        constexpr bool matchesBjorklund(int steps, int hits) {
+            const uint32_t bjorklund = getBjorklundPattern(steps, hits) & stepMask(steps);
+            if (countBits(bjorklund) != hits) return false;
+            if (hits > 0 && (bjorklund & 1u) == 0) return false;
+            return canonicalRotation(getPattern(steps, hits), steps) == canonicalRotation(bjorklund, steps);
+        }
+
+        constexpr bool checkAllPatterns() {
+            for (int steps = 1; steps <= kMaxSteps; ++steps)
+                for (int hits = 0; hits <= steps; ++hits)
+                    if (!matchesBjorklund(steps, hits))
+                        return false;
+            return true;
+        }
+
+        // The long-pattern spread must be the table's, so both agree where they overlap
+        constexpr bool spreadMatchesTable() {
+            for (int steps = 1; steps <= kMaxSteps; ++steps)
+                for (int hits = 0; hits <= steps; ++hits) {
+                    uint32_t pattern = 0;
+                    for (int step = 0; step < steps; ++step)
+                        if (isSpreadHit(step, steps, hits)) pattern |= 1u << step;
+                    if (pattern != (getPattern(steps, hits) & stepMask(steps)))
+                        return false;
+                }
+            return true;
+        }
+
+        constexpr int countHits(const PatternBits& bits) {
+            int count = 0;
+            for (int step = 0; step < kMaxLongSteps; ++step)
+                count += bits.test(step) ? 1 : 0;
+            return count;
+        }
+
+        static_assert(getBjorklundPattern(8, 3) == 0b01001001u, "Bjorklund E(3,8) is the tresillo x..x..x.");
+        static_assert(checkAllPatterns(), "Euclidean table must equal Bjorklund's algorithm in canonical rotation");
+        static_assert(getRotatedPattern(16, 4, 2) == 0x2222u, "Rotation moves hits later within the cycle");
+        static_assert(spreadMatchesTable(), "Long patterns must use the table's spread");
+        static_assert(countHits(getPatternBits(48, 7, 5)) == 7 && countHits(getPatternBits(128, 5, 127)) == 5,
+                      "Long patterns keep their hit count through rotation");
+        static_assert(getPatternBits(64, 16, 1).words[1] == 0x11111111u, "Long patterns spread across words");
+        static_assert(getBjorklundPattern(16, 5) == 0b0001001001001001u, "Bjorklund E(5,16) is the bossa nova x..x..x..x..x...");
+        static_assert(getBjorklundPattern(8, 5) == 0b01101101u, "Bjorklund E(5,8) is the cinquillo x.xx.xx.");
+        static_assert(getBjorklundPattern(12, 7) == 0b011010110101u, "Bjorklund E(7,12) is x.x.xx.x.xx.");
+        static_assert(canonicalRotation(getPattern(8, 3), 8) == 0b00100101u && canonicalRotation(0b01001001u, 8) == 0b00100101u,
+                      "The table's E(3,8) and the tresillo share the canonical rotation x.x..x..");
+        static_assert(getBjorklundBits(40, 5, 0).words[0] == 0x01010101u && getBjorklundBits(40, 5, 0).words[1] == 0x01u,
+                      "Long Bjorklund patterns start on a hit and spread across words");
+        static_assert(depositAccents(getBjorklundBits(8, 3, 0), 8, everyNthHit(3, 2)).words[0] == 0b01000001u,
+                      "Every 2nd hit of the tresillo is accented");
+    }
 }
 
-#endif // ENABLE_EUCLIDEAN_MODE
\ No newline at end of file
+#endif // ENABLE_EUCLIDEAN_MODE
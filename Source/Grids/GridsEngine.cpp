@@ -1,30 +1,134 @@
 #include "GridsEngine.h"
+#include "GridsInterpolation.h"
 
 GridsEngine::GridsEngine() {
-    // Seed random number generator
-    std::random_device rd;
-    rng_.seed(rd());
+    for (int voice = 0; voice < kMaxVoices; ++voice) {
+        voiceInstruments_[voice] = static_cast<uint8_t>(voice % kNumDrumVoices);
+        densities_[voice] = 1.0f;
+#ifdef ENABLE_EUCLIDEAN_MODE
+        euclidean_.setDensity(voice, 1.0f);
+        combineOps_[voice] = CombineOp::Or;
+        combineBlends_[voice] = 0.5f;
+#endif
+    }
+    
+    setSeed(seed_);
     reset();
 }
 
+void GridsEngine::setNumVoices(int numVoices) {
+    numVoices = juce::jlimit(1, kMaxVoices, numVoices);
+    if (numVoices != numVoices_) {
+        numVoices_ = numVoices;
+        masksDirty_ = true;
+        ++patternVersion_;
+    }
+}
+
+void GridsEngine::setVoiceInstrument(int voice, int instrument) {
+    if (!isValidVoice(voice)) return;
+    
+    auto row = static_cast<uint8_t>(juce::jlimit(0, kNumDrumVoices - 1, instrument));
+    if (row != voiceInstruments_[voice]) {
+        voiceInstruments_[voice] = row;
+        masksDirty_ = true;
+        ++patternVersion_;
+    }
+}
+
+void GridsEngine::setDensity(int voice, float density) {
+    if (!isValidVoice(voice)) return;
+    
+    density = juce::jlimit(0.0f, 1.0f, density);
+    if (density != densities_[voice]) {
+        // Chaos only adds ghost notes above zero density, so crossing zero changes the output
+        // even when the masks don't; otherwise updateCache bumps the version if the masks moved
+        bool changed = (density > 0.0f) != (densities_[voice] > 0.0f);
+        densities_[voice] = density;
+        masksDirty_ = true;
+#ifdef ENABLE_EUCLIDEAN_MODE
+        changed = euclidean_.setDensity(voice, density) || changed;
+#endif
+        if (changed) ++patternVersion_;
+    }
+}
+
+void GridsEngine::setSeed(uint32_t seed) {
+    seed_ = seed;
+    for (size_t voice = 0; voice < chaosKeys_.size(); ++voice) {
+        chaosKeys_[voice] = grids::streamKey(seed, voice);
+        velocityKeys_[voice] = grids::streamKey(seed, chaosKeys_.size() + voice);
+        blendKeys_[voice] = grids::streamKey(seed, 2 * chaosKeys_.size() + voice);
+    }
+    ++patternVersion_;
+}
+
+void GridsEngine::setVoiceVelocity(int voice, const VoiceVelocity& velocity) {
+    if (voice < 0 || voice >= static_cast<int>(velocities_.size())) return;
+    
+    if (velocity != velocities_[voice]) {
+        velocities_[voice] = velocity;
+        ++patternVersion_;
+    }
+}
+
+int GridsEngine::velocityAt(int voice, bool isAccent, int64_t absoluteStep) const {
+    if (voice < 0 || voice >= static_cast<int>(velocities_.size())) return 0;
+    
+    const auto& velocity = velocities_[voice];
+    if (isAccent) {
+        return velocity.accent;
+    }
+    
+    int result = velocity.normal;
+    if (velocity.variation > 0.0f) {
+        float random = grids::toUnitFloat(grids::hash(velocityKeys_[voice], static_cast<uint64_t>(absoluteStep)));
+        result = juce::jlimit<int>(velocity.min, velocity.max,
+                                   result + static_cast<int>((random - 0.5f) * velocity.variation));
+    }
+    
+    return juce::jmin(127, result + velocity.boost);
+}
+
 void GridsEngine::reset() {
     currentStep_ = 0;
+    absoluteStep_ = 0;
     swingCounter_ = 0;
-    bdTrigger_ = false;
-    sdTrigger_ = false;
-    hhTrigger_ = false;
-    bdAccent_ = false;
-    sdAccent_ = false;
-    hhAccent_ = false;
+    triggers_ = 0;
+    accents_ = 0;
+    stepLevels_.fill(0);
 }
 
 void GridsEngine::tick() {
     // Simply evaluate and advance - swing is now handled in the processor
     evaluateDrums();
-    currentStep_ = (currentStep_ + 1) % 32;
+    setCurrentStep(absoluteStep_ + 1);
+}
+
+void GridsEngine::updateCache() const {
+    if (levelsDirty_) {
+        if (rebuildLevels())
+            masksDirty_ = true;
+        levelsDirty_ = false;
+    }
+    
+    if (masksDirty_) {
+        const auto previousTriggers = triggerMasks_;
+        const auto previousAccents = accentMasks_;
+        rebuildMasks();
+        masksDirty_ = false;
+        
+        if (triggerMasks_ != previousTriggers || accentMasks_ != previousAccents)
+            ++patternVersion_;
+    }
 }
 
-uint8_t GridsEngine::readDrumMap(int instrument, int step) {
+bool GridsEngine::rebuildLevels() const {
+    if (interpolationMode_ == InterpolationMode::FixedPoint)
+        return rebuildLevelsFixedPoint();
+    
+    fixedPointLevelsKey_ = -1;
+    
     // Convert X/Y to grid coordinates
     float scaledX = x_ * 4.0f;  // 0-4 range for 5x5 grid
     float scaledY = y_ * 4.0f;
@@ -39,52 +143,178 @@ uint8_t GridsEngine::readDrumMap(int instrument, int step) {
     float fx = scaledX - x0;
     float fy = scaledY - y0;
     
-    // Get node indices
-    int node00 = y0 * 5 + x0;
-    int node01 = y0 * 5 + x1;
-    int node10 = y1 * 5 + x0;
-    int node11 = y1 * 5 + x1;
+    // Pattern layout: BD (0-31), SD (32-63), HH (64-95), blended a vector at a time
+    grids::blendNodesFloat(grids::node_table[y0 * 5 + x0]->data(),
+                           grids::node_table[y0 * 5 + x1]->data(),
+                           grids::node_table[y1 * 5 + x0]->data(),
+                           grids::node_table[y1 * 5 + x1]->data(),
+                           fx, fy, levels_.data());
+    return true;
+}
+
+bool GridsEngine::rebuildLevelsFixedPoint() const {
+    // Quantize X/Y to 8 bits once; everything after this is integer math,
+    // checked against the firmware's golden vectors by GridsGoldenTest.
+    // Moves smaller than a quantization step (a slow ramp) leave the levels as they are
+    const uint8_t x = static_cast<uint8_t>(x_ * 255.0f + 0.5f);
+    const uint8_t y = static_cast<uint8_t>(y_ * 255.0f + 0.5f);
+    const int key = x << 8 | y;
+    if (key == fixedPointLevelsKey_)
+        return false;
+    fixedPointLevelsKey_ = key;
+
+    const int x0 = grids::fixedPointCell(x);
+    const int y0 = grids::fixedPointCell(y);
+    const uint8_t fx = grids::fixedPointWeight(x);
+    const uint8_t fy = grids::fixedPointWeight(y);
     
-    // Calculate pattern offset for this instrument and step
-    // Pattern layout: BD (0-31), SD (32-63), HH (64-95)
-    int offset = instrument * 32 + step;
+    grids::blendNodes(grids::node_table[y0 * 5 + x0]->data(),
+                      grids::node_table[y0 * 5 + x0 + 1]->data(),
+                      grids::node_table[(y0 + 1) * 5 + x0]->data(),
+                      grids::node_table[(y0 + 1) * 5 + x0 + 1]->data(),
+                      fx, fy, levels_.data());
+    return true;
+}
+
+void GridsEngine::rebuildMasks() const {
+    const bool fixedPoint = interpolationMode_ == InterpolationMode::FixedPoint;
+    const uint8_t accentThreshold = fixedPoint ? 192 : 200;
     
-    // Read values from the four nearest nodes
-    uint8_t v00 = (*grids::node_table[node00])[offset];
-    uint8_t v01 = (*grids::node_table[node01])[offset];
-    uint8_t v10 = (*grids::node_table[node10])[offset];
-    uint8_t v11 = (*grids::node_table[node11])[offset];
+    for (int voice = 0; voice < numVoices_; ++voice) {
+        const uint8_t* levels = levels_.data() + voiceInstruments_[voice] * grids::kPatternLength;
+        const float density = densities_[voice];
+        uint32_t triggers = 0;
+        uint32_t accents = 0;
+        
+        for (size_t step = 0; step < grids::kPatternLength; ++step) {
+            const bool trigger = fixedPoint ? applyDensityFixedPoint(levels[step], density)
+                                            : applyDensity(levels[step], density);
+            triggers |= static_cast<uint32_t>(trigger) << step;
+            
+            // Values > 200 are accented, or > 192 as in the firmware
+            accents |= static_cast<uint32_t>(levels[step] > accentThreshold) << step;
+        }
+        
+        triggerMasks_[voice] = triggers;
+        accentMasks_[voice] = accents;
+    }
+}
+
+#ifdef ENABLE_EUCLIDEAN_MODE
+void GridsEngine::updateHybridMasks(int64_t window) const {
+    if (hybridValid_ && window == hybridWindow_ && patternVersion_ == hybridVersion_) return;
     
-    // Bilinear interpolation
-    float v0 = v00 * (1.0f - fx) + v01 * fx;
-    float v1 = v10 * (1.0f - fx) + v11 * fx;
-    float result = v0 * (1.0f - fy) + v1 * fy;
+    const int64_t firstStep = window * 32;
+    for (int voice = 0; voice < numVoices_; ++voice) {
+        const uint32_t grids = triggerMasks_[voice];
+        const uint32_t euclidean = euclidean_.getWindow(voice, firstStep);
+        
+        uint32_t combined = 0;
+        switch (combineOps_[voice]) {
+            case CombineOp::And:    combined = grids & euclidean; break;
+            case CombineOp::Or:     combined = grids | euclidean; break;
+            case CombineOp::Xor:    combined = grids ^ euclidean; break;
+            case CombineOp::AndNot: combined = grids & ~euclidean; break;
+            case CombineOp::Blend: {
+                // Which steps take the Euclidean bit - addressed like chaos, by (seed, absolute step, voice)
+                uint32_t fromEuclidean = 0;
+                for (int step = 0; step < 32; ++step) {
+                    const float random = grids::toUnitFloat(grids::hash(blendKeys_[voice], static_cast<uint64_t>(firstStep + step)));
+                    fromEuclidean |= static_cast<uint32_t>(random < combineBlends_[voice]) << step;
+                }
+                combined = (euclidean & fromEuclidean) | (grids & ~fromEuclidean);
+                break;
+            }
+        }
+        hybridMasks_[voice] = combined;
+    }
     
-    return static_cast<uint8_t>(result);
+    hybridWindow_ = window;
+    hybridVersion_ = patternVersion_;
+    hybridValid_ = true;
 }
+#endif
 
 void GridsEngine::evaluateDrums() {
-    // Read pattern values for current step
-    uint8_t bdValue = readDrumMap(0, currentStep_);
-    uint8_t sdValue = readDrumMap(1, currentStep_);
-    uint8_t hhValue = readDrumMap(2, currentStep_);
+    uint32_t triggers = 0;
+    uint32_t accents = 0;
+    evaluateStep(absoluteStep_, triggers, accents);
+    
+    triggers_ = triggers;
+    accents_ = accents;
+    for (int voice = 0; voice < numVoices_; ++voice) {
+        stepLevels_[voice] = levels_[voiceInstruments_[voice] * grids::kPatternLength + currentStep_];
+    }
+}
+
+void GridsEngine::evaluateStep(int64_t absoluteStep, uint32_t& triggers, uint32_t& accents) const {
+    updateCache();
+    
+    // One pass over the voice arrays - each voice is a bit test against its cached mask
+    const uint32_t step = static_cast<uint32_t>(((absoluteStep % 32) + 32) % 32);
+    triggers = 0;
+    accents = 0;
+    
+#ifdef ENABLE_EUCLIDEAN_MODE
+    const bool euclidean = patternMode_ == PatternMode::Euclidean;
+    
+    // Hybrid masks are combined a whole window at a time, so a step is still a bit test
+    const bool hybrid = patternMode_ == PatternMode::Hybrid;
+    if (hybrid) {
+        updateHybridMasks((absoluteStep - static_cast<int64_t>(step)) / 32);
+    }
+    const auto& masks = hybrid ? hybridMasks_ : triggerMasks_;
+#endif
     
-    // Apply density thresholds
-    bdTrigger_ = applyDensity(bdValue, bdDensity_);
-    sdTrigger_ = applyDensity(sdValue, sdDensity_);
-    hhTrigger_ = applyDensity(hhValue, hhDensity_);
+    for (int voice = 0; voice < numVoices_; ++voice) {
+#ifdef ENABLE_EUCLIDEAN_MODE
+        bool trigger = euclidean ? euclidean_.getTrigger(voice, absoluteStep)
+                                 : ((masks[voice] >> step) & 1u);
+#else
+        bool trigger = (triggerMasks_[voice] >> step) & 1u;
+#endif
+        
+        // Apply chaos only if density > 0 (don't add ghost notes when density is zero)
+        if (chaos_ > 0.0f && densities_[voice] > 0.0f) {
+            trigger = applyChaos(trigger, voice, absoluteStep);
+        }
+        
+        // Determine accents (levels over the accent threshold; Euclidean patterns carry their own
+        // accent sub-pattern, hybrid hits keep the map's accents)
+#ifdef ENABLE_EUCLIDEAN_MODE
+        const bool accent = trigger && (euclidean ? euclidean_.getAccent(voice, absoluteStep)
+                                                  : ((accentMasks_[voice] >> step) & 1u));
+#else
+        const bool accent = trigger && ((accentMasks_[voice] >> step) & 1u);
+#endif
+        
+        triggers |= static_cast<uint32_t>(trigger) << voice;
+        accents |= static_cast<uint32_t>(accent) << voice;
+    }
+}
+
+int GridsEngine::renderSteps(int64_t firstStep, int numSteps, PatternEvent* events, int maxEvents) const {
+    int numEvents = 0;
     
-    // Apply chaos only if density > 0 (don't add ghost notes when density is zero)
-    if (chaos_ > 0.0f) {
-        if (bdDensity_ > 0.0f) bdTrigger_ = applyChaos(bdTrigger_);
-        if (sdDensity_ > 0.0f) sdTrigger_ = applyChaos(sdTrigger_);
-        if (hhDensity_ > 0.0f) hhTrigger_ = applyChaos(hhTrigger_);
+    for (int64_t step = firstStep; step < firstStep + numSteps; ++step) {
+        uint32_t triggers = 0;
+        uint32_t accents = 0;
+        evaluateStep(step, triggers, accents);
+        
+        for (int voice = 0; voice < numVoices_ && triggers != 0; ++voice, triggers >>= 1) {
+            if (!(triggers & 1u)) continue;
+            if (numEvents >= maxEvents) return numEvents;
+            
+            const bool accent = (accents >> voice) & 1u;
+            auto& event = events[numEvents++];
+            event.step = step;
+            event.voice = static_cast<uint8_t>(voice);
+            event.velocity = static_cast<uint8_t>(velocityAt(voice, accent, step));
+            event.accent = accent;
+        }
     }
     
-    // Determine accents (values > 200 are accented)
-    bdAccent_ = bdValue > 200 && bdTrigger_;
-    sdAccent_ = sdValue > 200 && sdTrigger_;
-    hhAccent_ = hhValue > 200 && hhTrigger_;
+    return numEvents;
 }
 
 bool GridsEngine::applyDensity(uint8_t value, float density) {
@@ -99,8 +329,18 @@ bool GridsEngine::applyDensity(uint8_t value, float density) {
     return value > threshold;
 }
 
-bool GridsEngine::applyChaos(bool trigger) {
-    float random = randomDist_(rng_);
+bool GridsEngine::applyDensityFixedPoint(uint8_t value, float density) {
+    // Firmware threshold: trigger when the level exceeds the inverted 8-bit density
+    if (density <= 0.0f) {
+        return false;
+    }
+    
+    const uint8_t threshold = static_cast<uint8_t>(~static_cast<uint8_t>(density * 255.0f + 0.5f));
+    return value > threshold;
+}
+
+bool GridsEngine::applyChaos(bool trigger, int voice, int64_t absoluteStep) const {
+    float random = grids::toUnitFloat(grids::hash(chaosKeys_[voice], static_cast<uint64_t>(absoluteStep)));
     
     if (trigger) {
         // Chaos can remove triggers
@@ -111,26 +351,40 @@ bool GridsEngine::applyChaos(bool trigger) {
     }
 }
 
-std::array<uint8_t, 32> GridsEngine::getBDPattern() const {
-    std::array<uint8_t, 32> pattern;
-    for (int i = 0; i < 32; i++) {
-        pattern[i] = const_cast<GridsEngine*>(this)->readDrumMap(0, i);
-    }
+std::array<uint8_t, 32> GridsEngine::getPattern(int voice) const {
+    std::array<uint8_t, 32> pattern{};
+    if (!isValidVoice(voice)) return pattern;
+    
+    updateCache();
+    std::copy_n(levels_.begin() + voiceInstruments_[voice] * grids::kPatternLength, 32, pattern.begin());
     return pattern;
 }
 
-std::array<uint8_t, 32> GridsEngine::getSDPattern() const {
-    std::array<uint8_t, 32> pattern;
-    for (int i = 0; i < 32; i++) {
-        pattern[i] = const_cast<GridsEngine*>(this)->readDrumMap(1, i);
-    }
-    return pattern;
+int64_t GridsEngine::getPatternWindow() const {
+    if (patternMode_ == PatternMode::Grids) return 0;
+    return (absoluteStep_ - currentStep_) / 32;
 }
 
-std::array<uint8_t, 32> GridsEngine::getHHPattern() const {
-    std::array<uint8_t, 32> pattern;
-    for (int i = 0; i < 32; i++) {
-        pattern[i] = const_cast<GridsEngine*>(this)->readDrumMap(2, i);
+uint32_t GridsEngine::getTriggerMask(int voice) const {
+    if (!isValidVoice(voice) || voice >= numVoices_) return 0;
+#ifdef ENABLE_EUCLIDEAN_MODE
+    if (patternMode_ == PatternMode::Euclidean) return euclidean_.getWindow(voice, getPatternWindow() * 32);
+#endif
+    updateCache();
+#ifdef ENABLE_EUCLIDEAN_MODE
+    if (patternMode_ == PatternMode::Hybrid) {
+        updateHybridMasks(getPatternWindow());
+        return hybridMasks_[voice];
     }
-    return pattern;
-}
\ No newline at end of file
+#endif
+    return triggerMasks_[voice];
+}
+
+uint32_t GridsEngine::getAccentMask(int voice) const {
+    if (!isValidVoice(voice) || voice >= numVoices_) return 0;
+#ifdef ENABLE_EUCLIDEAN_MODE
+    if (patternMode_ == PatternMode::Euclidean) return euclidean_.getAccentWindow(voice, getPatternWindow() * 32);
+#endif
+    updateCache();
+    return patternMode_ == PatternMode::Hybrid ? accentMasks_[voice] & getTriggerMask(voice) : accentMasks_[voice];
+}
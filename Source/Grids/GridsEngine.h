@@ -2,32 +2,185 @@
 
 #include <JuceHeader.h>
 #include "GridsPatternData.h"
-#include <random>
+#include "GridsRandom.h"
+#include "EuclideanEngine.h"
 
 class GridsEngine {
 public:
+    // How the pattern map is interpolated between nodes
+    enum class InterpolationMode {
+        Float,       // Float bilinear weights (original Griddy behaviour)
+        FixedPoint   // 8-bit integer math matching the Grids firmware, bit-identical everywhere
+    };
+    
+    // Voices are stored structure-of-arrays. The first three are the classic
+    // BD/SD/HH outputs; extra voices (accent/ghost/fill lanes...) can read any
+    // instrument row of the map with their own density.
+    static constexpr int kMaxVoices = 8;
+    static constexpr int kNumDrumVoices = static_cast<int>(grids::kNumInstruments);
+    
+    // Where each step's triggers come from
+    enum class PatternMode {
+        Grids,      // The interpolated drum map
+        Euclidean,  // Evenly spread hits per voice (density sets the hit count)
+        Hybrid      // Grids and Euclidean masks combined per voice
+    };
+    
+    // How a voice's Grids mask (G) and Euclidean mask (E) combine in Hybrid mode
+    enum class CombineOp {
+        And,        // G & E
+        Or,         // G | E
+        Xor,        // G ^ E
+        AndNot,     // G & ~E - the Euclidean pattern carves rests out of the map
+        Blend       // Each step from E with probability `blend`, otherwise from G
+    };
+    
+    // One hit in a rendered lookahead window
+    struct PatternEvent {
+        int64_t step = 0;      // Absolute step index
+        uint8_t voice = 0;
+        uint8_t velocity = 0;
+        bool accent = false;
+    };
+    
     GridsEngine();
     ~GridsEngine() = default;
     
     // Pattern position (0.0 to 1.0)
-    void setX(float x) { x_ = juce::jlimit(0.0f, 1.0f, x); }
-    void setY(float y) { y_ = juce::jlimit(0.0f, 1.0f, y); }
+    // Setters only invalidate the pattern cache when the value actually changes
+    void setX(float x) { setCoordinate(x_, x); }
+    void setY(float y) { setCoordinate(y_, y); }
     float getX() const { return x_; }
     float getY() const { return y_; }
     
+    // Number of active voices (1 to kMaxVoices, default BD/SD/HH)
+    void setNumVoices(int numVoices);
+    int getNumVoices() const { return numVoices_; }
+    
+    // Which instrument row of the pattern map a voice reads (0 = BD, 1 = SD, 2 = HH)
+    void setVoiceInstrument(int voice, int instrument);
+    int getVoiceInstrument(int voice) const { return isValidVoice(voice) ? voiceInstruments_[voice] : 0; }
+    
     // Density controls (0.0 to 1.0)
-    void setBDDensity(float density) { bdDensity_ = juce::jlimit(0.0f, 1.0f, density); }
-    void setSDDensity(float density) { sdDensity_ = juce::jlimit(0.0f, 1.0f, density); }
-    void setHHDensity(float density) { hhDensity_ = juce::jlimit(0.0f, 1.0f, density); }
-    float getBDDensity() const { return bdDensity_; }
-    float getSDDensity() const { return sdDensity_; }
-    float getHHDensity() const { return hhDensity_; }
+    void setDensity(int voice, float density);
+    float getDensity(int voice) const { return isValidVoice(voice) ? densities_[voice] : 0.0f; }
+    
+    // Classic three-voice API
+    void setBDDensity(float density) { setDensity(0, density); }
+    void setSDDensity(float density) { setDensity(1, density); }
+    void setHHDensity(float density) { setDensity(2, density); }
+    float getBDDensity() const { return densities_[0]; }
+    float getSDDensity() const { return densities_[1]; }
+    float getHHDensity() const { return densities_[2]; }
+    
+    // Interpolation mode (invalidates the pattern cache when it changes)
+    void setInterpolationMode(InterpolationMode mode) {
+        if (mode != interpolationMode_) {
+            interpolationMode_ = mode;
+            levelsDirty_ = true;
+            ++patternVersion_;
+        }
+    }
+    InterpolationMode getInterpolationMode() const { return interpolationMode_; }
+    
+#ifdef ENABLE_EUCLIDEAN_MODE
+    static_assert(EuclideanEngine::kMaxVoices == kMaxVoices, "Euclidean voices must match the engine's");
+    
+    // Pattern source, and the per-voice Euclidean cycle (1-128 steps) and rotation
+    void setPatternMode(PatternMode mode) {
+        if (mode != patternMode_) {
+            patternMode_ = mode;
+            ++patternVersion_;
+        }
+    }
+    void setEuclideanLength(int voice, int length) {
+        if (euclidean_.setLength(voice, length)) ++patternVersion_;
+    }
+    void setEuclideanRotation(int voice, int rotation) {
+        if (euclidean_.setRotation(voice, rotation)) ++patternVersion_;
+    }
+    void setEuclideanAlgorithm(EuclideanEngine::Algorithm algorithm) {
+        if (euclidean_.setAlgorithm(algorithm)) ++patternVersion_;
+    }
+    void setEuclideanAccent(int voice, EuclideanEngine::AccentMode mode, int value) {
+        if (euclidean_.setAccent(voice, mode, value)) ++patternVersion_;
+    }
+    const EuclideanEngine& getEuclidean() const { return euclidean_; }
+    
+    // Per-voice combiner for Hybrid mode
+    void setCombineOp(int voice, CombineOp op) {
+        if (isValidVoice(voice) && op != combineOps_[voice]) {
+            combineOps_[voice] = op;
+            ++patternVersion_;
+        }
+    }
+    void setCombineBlend(int voice, float blend) {
+        blend = juce::jlimit(0.0f, 1.0f, blend);
+        if (isValidVoice(voice) && blend != combineBlends_[voice]) {
+            combineBlends_[voice] = blend;
+            ++patternVersion_;
+        }
+    }
+    CombineOp getCombineOp(int voice) const { return isValidVoice(voice) ? combineOps_[voice] : CombineOp::Or; }
+    float getCombineBlend(int voice) const { return isValidVoice(voice) ? combineBlends_[voice] : 0.0f; }
+#endif
+    PatternMode getPatternMode() const { return patternMode_; }
     
     // Chaos/randomness (0.0 to 1.0)
-    void setChaos(float chaos) { chaos_ = juce::jlimit(0.0f, 1.0f, chaos); }
+    void setChaos(float chaos) {
+        chaos = juce::jlimit(0.0f, 1.0f, chaos);
+        if (chaos != chaos_) {
+            chaos_ = chaos;
+            ++patternVersion_;
+        }
+    }
+    
+    // Chaos seed - the same seed gives the same ghost notes at the same step
+    void setSeed(uint32_t seed);
+    uint32_t getSeed() const { return seed_; }
+    
+    // Per-voice velocity profile, precomputed once per block so note-ons are a table lookup
+    struct VoiceVelocity {
+        uint8_t normal = 100;   // Unaccented velocity before variation
+        uint8_t accent = 127;   // Accented velocity
+        uint8_t min = 1;        // Variation is clamped to [min, max]
+        uint8_t max = 127;
+        uint8_t boost = 0;      // Added after variation (e.g. BD sits louder)
+        float variation = 0.0f; // Peak-to-peak random variation in velocity steps
+        
+        bool operator==(const VoiceVelocity& other) const {
+            return normal == other.normal && accent == other.accent && min == other.min
+                && max == other.max && boost == other.boost && variation == other.variation;
+        }
+        bool operator!=(const VoiceVelocity& other) const { return !(*this == other); }
+    };
+    void setVoiceVelocity(int voice, const VoiceVelocity& velocity);
+    
+    // Velocity for a voice at the current step. Variation is addressed like chaos,
+    // by (seed, absolute step, voice), so it needs no shared random generator
+    int getVelocity(int voice, bool isAccent) const { return velocityAt(voice, isAccent, absoluteStep_); }
+    
+    /**
+     * Renders every hit in steps [firstStep, firstStep + numSteps) into a
+     * caller-owned buffer, ordered by step then voice, without touching the
+     * playback position or allocating. Returns the number of events written;
+     * rendering stops early when maxEvents is reached.
+     */
+    int renderSteps(int64_t firstStep, int numSteps, PatternEvent* events, int maxEvents) const;
     
-    // Swing amount (0.0 to 1.0, where 0.5 is no swing)
-    void setSwing(float swing) { swing_ = juce::jlimit(0.0f, 1.0f, swing); }
+    // Changes whenever anything that affects rendered events changes (chaos, seed,
+    // voices, velocities, interpolation, or X/Y and densities once they move a
+    // trigger or accent). Ramped X/Y and densities mostly don't, so it's brought
+    // up to date here rather than bumped by every setter call
+    uint32_t getPatternVersion() const {
+        updateCache();
+        return patternVersion_;
+    }
+    
+    // The 32-step window the playhead is in. Euclidean cycles that don't divide 32
+    // and hybrid masks differ from one window to the next without the pattern
+    // version changing. Always 0 in Grids mode, where masks don't depend on position
+    int64_t getPatternWindow() const;
     
     // Pattern reset
     void reset();
@@ -35,70 +188,145 @@ public:
     // Advance the pattern by one step
     void tick();
     
-    // Set the current step directly (for PPQ sync)
-    void setCurrentStep(int step) { currentStep_ = step % 32; }
+    // Set the current step directly (for PPQ sync). The absolute step index
+    // addresses chaos, so the same transport position always gives the same notes.
+    void setCurrentStep(int64_t absoluteStep) {
+        absoluteStep_ = absoluteStep;
+        currentStep_ = static_cast<int>(((absoluteStep % 32) + 32) % 32);
+    }
+    int64_t getAbsoluteStep() const { return absoluteStep_; }
+    
+    // Current step triggers/accents as bitsets (bit v = voice v, after tick)
+    uint32_t getTriggerBits() const { return triggers_; }
+    uint32_t getAccentBits() const { return accents_; }
+    bool getTrigger(int voice) const { return isValidVoice(voice) && ((triggers_ >> voice) & 1u); }
+    bool getAccent(int voice) const { return isValidVoice(voice) && ((accents_ >> voice) & 1u); }
+    
+    // Interpolated map level of each voice at the current step
+    uint8_t getLevel(int voice) const { return isValidVoice(voice) ? stepLevels_[voice] : 0; }
     
     // Get current step triggers (after tick)
-    bool getBDTrigger() const { return bdTrigger_; }
-    bool getSDTrigger() const { return sdTrigger_; }
-    bool getHHTrigger() const { return hhTrigger_; }
+    bool getBDTrigger() const { return getTrigger(0); }
+    bool getSDTrigger() const { return getTrigger(1); }
+    bool getHHTrigger() const { return getTrigger(2); }
     
     // Get accent triggers
-    bool getBDAccent() const { return bdAccent_; }
-    bool getSDAccent() const { return sdAccent_; }
-    bool getHHAccent() const { return hhAccent_; }
+    bool getBDAccent() const { return getAccent(0); }
+    bool getSDAccent() const { return getAccent(1); }
+    bool getHHAccent() const { return getAccent(2); }
     
     // Get current pattern step (0-31)
     int getCurrentStep() const { return currentStep_; }
     
     // Get interpolated pattern values for visualization
-    std::array<uint8_t, 32> getBDPattern() const;
-    std::array<uint8_t, 32> getSDPattern() const;
-    std::array<uint8_t, 32> getHHPattern() const;
+    std::array<uint8_t, 32> getPattern(int voice) const;
+    std::array<uint8_t, 32> getBDPattern() const { return getPattern(0); }
+    std::array<uint8_t, 32> getSDPattern() const { return getPattern(1); }
+    std::array<uint8_t, 32> getHHPattern() const { return getPattern(2); }
+    
+    // 32-step masks for the window the playhead is in (bit i = step i): the cached
+    // map masks for the current X/Y/density, or the Euclidean or combined hybrid
+    // masks for that window
+    uint32_t getTriggerMask(int voice) const;
+    uint32_t getAccentMask(int voice) const;
     
     // Evaluate drums for current step (public for retrigger mode)
     void evaluateDrums();
     
 private:
-    // Bilinear interpolation of pattern nodes
-    uint8_t readDrumMap(int instrument, int step);
+    // The version only moves if the new position changes the masks (see updateCache)
+    void setCoordinate(float& coordinate, float value) {
+        value = juce::jlimit(0.0f, 1.0f, value);
+        if (value != coordinate) {
+            coordinate = value;
+            levelsDirty_ = true;
+        }
+    }
+    
+    static bool isValidVoice(int voice) { return voice >= 0 && voice < kMaxVoices; }
+    
+    // Rebuild whatever part of the pattern cache is out of date
+    void updateCache() const;
+    
+    // Bilinear interpolation of the four nearest nodes for all 96 bytes. Returns
+    // false when Fixed-Point mode's 8-bit X/Y haven't moved and nothing was done
+    bool rebuildLevels() const;
+    bool rebuildLevelsFixedPoint() const;
+    
+    // Threshold the cached levels into per-voice trigger/accent masks
+    void rebuildMasks() const;
     
     // Apply density threshold
-    bool applyDensity(uint8_t value, float density);
+    static bool applyDensity(uint8_t value, float density);
+    static bool applyDensityFixedPoint(uint8_t value, float density);
     
-    // Apply chaos/randomness
-    bool applyChaos(bool trigger);
+#ifdef ENABLE_EUCLIDEAN_MODE
+    // Combine the Grids and Euclidean masks for a 32-step window (step 32 * window onwards).
+    // Only does any work when the window or the pattern changed
+    void updateHybridMasks(int64_t window) const;
+#endif
+    
+    // Trigger/accent bitsets for an absolute step, without changing any state
+    void evaluateStep(int64_t absoluteStep, uint32_t& triggers, uint32_t& accents) const;
+    
+    // Apply chaos/randomness - a pure function of (seed, absolute step, voice)
+    bool applyChaos(bool trigger, int voice, int64_t absoluteStep) const;
+    
+    // Velocity of a voice at an absolute step
+    int velocityAt(int voice, bool isAccent, int64_t absoluteStep) const;
     
     // Pattern position (0.0 to 1.0)
     float x_ = 0.5f;
     float y_ = 0.5f;
     
-    // Density controls
-    float bdDensity_ = 1.0f;
-    float sdDensity_ = 1.0f;
-    float hhDensity_ = 1.0f;
+    InterpolationMode interpolationMode_ = InterpolationMode::Float;
+    PatternMode patternMode_ = PatternMode::Grids;
+    
+#ifdef ENABLE_EUCLIDEAN_MODE
+    EuclideanEngine euclidean_;
+    std::array<CombineOp, kMaxVoices> combineOps_{};
+    std::array<float, kMaxVoices> combineBlends_{};
+    
+    // Combined masks for one 32-step window, tagged with the pattern version they came from
+    mutable std::array<uint32_t, kMaxVoices> hybridMasks_{};
+    mutable int64_t hybridWindow_ = 0;
+    mutable uint32_t hybridVersion_ = 0;
+    mutable bool hybridValid_ = false;
+#endif
+    
+    // Voice configuration
+    int numVoices_ = kNumDrumVoices;
+    std::array<uint8_t, kMaxVoices> voiceInstruments_{};
+    std::array<float, kMaxVoices> densities_{};
     
     // Chaos/randomness
     float chaos_ = 0.0f;
     
-    // Swing
-    float swing_ = 0.5f;
-    
-    // Current step in pattern (0-31)
+    // Current step in pattern (0-31) and the absolute step it came from
     int currentStep_ = 0;
+    int64_t absoluteStep_ = 0;
     int swingCounter_ = 0;
     
-    // Trigger outputs
-    bool bdTrigger_ = false;
-    bool sdTrigger_ = false;
-    bool hhTrigger_ = false;
+    // Outputs for the current step (bit v = voice v) and each voice's level
+    uint32_t triggers_ = 0;
+    uint32_t accents_ = 0;
+    std::array<uint8_t, kMaxVoices> stepLevels_{};
+    
+    // Pattern cache for the current X/Y/density tuple
+    mutable std::array<uint8_t, grids::kNodeSize> levels_{};
+    mutable std::array<uint32_t, kMaxVoices> triggerMasks_{};
+    mutable std::array<uint32_t, kMaxVoices> accentMasks_{};
+    mutable bool levelsDirty_ = true;
+    mutable bool masksDirty_ = true;
+    mutable int fixedPointLevelsKey_ = -1;  // 8-bit X/Y the levels were built at (-1 = none)
+    mutable uint32_t patternVersion_ = 0;
     
-    // Accent outputs
-    bool bdAccent_ = false;
-    bool sdAccent_ = false;
-    bool hhAccent_ = false;
+    // Chaos seed and the per-voice keys derived from it
+    uint32_t seed_ = 0;
+    std::array<uint64_t, kMaxVoices> chaosKeys_{};
+    std::array<uint64_t, kMaxVoices> velocityKeys_{};
+    std::array<uint64_t, kMaxVoices> blendKeys_{};
     
-    // Random number generator
-    std::mt19937 rng_;
-    std::uniform_real_distribution<float> randomDist_{0.0f, 1.0f};
+    // Velocity table
+    std::array<VoiceVelocity, kMaxVoices> velocities_{};
 };
\ No newline at end of file
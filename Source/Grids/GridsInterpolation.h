@@ -0,0 +1,275 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "GridsPatternData.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define GRIDS_INTERPOLATION_SSE2 1
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+    #define GRIDS_INTERPOLATION_NEON 1
+    #include <arm_neon.h>
+#endif
+
+namespace grids {
+
+/**
+ * Whole-node bilinear interpolation with 8-bit fixed-point weights.
+ *
+ * Blends the four neighbouring 96-byte nodes in one pass instead of one
+ * byte per readDrumMap() call. The arithmetic is the 8-bit crossfade used by
+ * the original Grids firmware, so the SIMD paths and the scalar fallback
+ * produce identical bytes on every architecture. blendNodesFloat does the
+ * same for the float weights of GridsEngine's Float mode.
+ */
+
+// (a * (255 - balance) + b * balance) >> 8 - the firmware's U8Mix
+constexpr uint8_t u8Mix(uint8_t a, uint8_t b, uint8_t balance) {
+    return static_cast<uint8_t>((a * (255 - balance) + b * balance) >> 8);
+}
+
+// As in the firmware, the top two bits of an 8-bit coordinate pick the cell
+// and the remaining six (shifted up to 0-252) are the crossfade weight
+constexpr int fixedPointCell(uint8_t coordinate) { return coordinate >> 6; }
+constexpr uint8_t fixedPointWeight(uint8_t coordinate) { return static_cast<uint8_t>(coordinate << 2); }
+
+// One byte of the blend at 8-bit X/Y - the firmware's ReadDrumMap
+constexpr uint8_t readDrumMapFixedPoint(uint8_t x, uint8_t y, size_t offset) {
+    const int cell = fixedPointCell(y) * 5 + fixedPointCell(x);
+    const uint8_t fx = fixedPointWeight(x);
+    return u8Mix(u8Mix((*node_table[cell])[offset], (*node_table[cell + 1])[offset], fx),
+                 u8Mix((*node_table[cell + 5])[offset], (*node_table[cell + 6])[offset], fx),
+                 fixedPointWeight(y));
+}
+
+// Reference implementation, also used on targets without SSE2/NEON
+inline void blendNodesScalar(const uint8_t* n00, const uint8_t* n01,
+                             const uint8_t* n10, const uint8_t* n11,
+                             uint8_t fx, uint8_t fy, uint8_t* out,
+                             size_t length = kNodeSize) {
+    for (size_t i = 0; i < length; ++i) {
+        out[i] = u8Mix(u8Mix(n00[i], n01[i], fx), u8Mix(n10[i], n11[i], fx), fy);
+    }
+}
+
+#if GRIDS_INTERPOLATION_SSE2
+namespace detail {
+    // Mix 8 zero-extended 16-bit lanes; products never exceed 255 * 255
+    inline __m128i mix16(__m128i a, __m128i b, __m128i inverse, __m128i balance) {
+        __m128i sum = _mm_add_epi16(_mm_mullo_epi16(a, inverse), _mm_mullo_epi16(b, balance));
+        return _mm_srli_epi16(sum, 8);
+    }
+}
+#endif
+
+// Blends `length` bytes (a multiple of 16 on the vector paths, kNodeSize by default)
+inline void blendNodes(const uint8_t* n00, const uint8_t* n01,
+                       const uint8_t* n10, const uint8_t* n11,
+                       uint8_t fx, uint8_t fy, uint8_t* out,
+                       size_t length = kNodeSize) {
+    size_t i = 0;
+
+#if GRIDS_INTERPOLATION_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i wx = _mm_set1_epi16(fx);
+    const __m128i wxInv = _mm_set1_epi16(static_cast<short>(255 - fx));
+    const __m128i wy = _mm_set1_epi16(fy);
+    const __m128i wyInv = _mm_set1_epi16(static_cast<short>(255 - fy));
+
+    for (; i + 16 <= length; i += 16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n00 + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n01 + i));
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n10 + i));
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n11 + i));
+
+        const __m128i topLo = detail::mix16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero), wxInv, wx);
+        const __m128i topHi = detail::mix16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero), wxInv, wx);
+        const __m128i bottomLo = detail::mix16(_mm_unpacklo_epi8(c, zero), _mm_unpacklo_epi8(d, zero), wxInv, wx);
+        const __m128i bottomHi = detail::mix16(_mm_unpackhi_epi8(c, zero), _mm_unpackhi_epi8(d, zero), wxInv, wx);
+
+        const __m128i lo = detail::mix16(topLo, bottomLo, wyInv, wy);
+        const __m128i hi = detail::mix16(topHi, bottomHi, wyInv, wy);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(lo, hi));
+    }
+#elif GRIDS_INTERPOLATION_NEON
+    const uint8x8_t wx = vdup_n_u8(fx);
+    const uint8x8_t wxInv = vdup_n_u8(static_cast<uint8_t>(255 - fx));
+    const uint8x8_t wy = vdup_n_u8(fy);
+    const uint8x8_t wyInv = vdup_n_u8(static_cast<uint8_t>(255 - fy));
+
+    auto mix8 = [](uint8x8_t a, uint8x8_t b, uint8x8_t inverse, uint8x8_t balance) {
+        return vshrn_n_u16(vmlal_u8(vmull_u8(a, inverse), b, balance), 8);
+    };
+
+    for (; i + 16 <= length; i += 16) {
+        const uint8x16_t a = vld1q_u8(n00 + i);
+        const uint8x16_t b = vld1q_u8(n01 + i);
+        const uint8x16_t c = vld1q_u8(n10 + i);
+        const uint8x16_t d = vld1q_u8(n11 + i);
+
+        const uint8x8_t topLo = mix8(vget_low_u8(a), vget_low_u8(b), wxInv, wx);
+        const uint8x8_t topHi = mix8(vget_high_u8(a), vget_high_u8(b), wxInv, wx);
+        const uint8x8_t bottomLo = mix8(vget_low_u8(c), vget_low_u8(d), wxInv, wx);
+        const uint8x8_t bottomHi = mix8(vget_high_u8(c), vget_high_u8(d), wxInv, wx);
+
+        vst1q_u8(out + i, vcombine_u8(mix8(topLo, bottomLo, wyInv, wy),
+                                      mix8(topHi, bottomHi, wyInv, wy)));
+    }
+#endif
+
+    // Scalar tail (or the whole node when no vector unit is available)
+    blendNodesScalar(n00 + i, n01 + i, n10 + i, n11 + i, fx, fy, out + i, length - i);
+}
+
+// Float bilinear blend, as readDrumMap() computed it per byte: each crossfade is
+// a * (1 - w) + b * w in float, truncated at the end. Reference for blendNodesFloat
+inline void blendNodesFloatScalar(const uint8_t* n00, const uint8_t* n01,
+                                  const uint8_t* n10, const uint8_t* n11,
+                                  float fx, float fy, uint8_t* out,
+                                  size_t length = kNodeSize) {
+    for (size_t i = 0; i < length; ++i) {
+        float v0 = n00[i] * (1.0f - fx) + n01[i] * fx;
+        float v1 = n10[i] * (1.0f - fx) + n11[i] * fx;
+        out[i] = static_cast<uint8_t>(v0 * (1.0f - fy) + v1 * fy);
+    }
+}
+
+#if GRIDS_INTERPOLATION_SSE2
+namespace detail {
+    // a * inverse + b * weight on 4 float lanes - multiplies and adds kept separate like the scalar loop
+    inline __m128 mixFloat(__m128 a, __m128 b, __m128 inverse, __m128 weight) {
+        return _mm_add_ps(_mm_mul_ps(a, inverse), _mm_mul_ps(b, weight));
+    }
+
+    // Blend 4 zero-extended 32-bit lanes and truncate back to integers
+    inline __m128i blendFloat4(__m128i a, __m128i b, __m128i c, __m128i d,
+                               __m128 wxInv, __m128 wx, __m128 wyInv, __m128 wy) {
+        const __m128 top = mixFloat(_mm_cvtepi32_ps(a), _mm_cvtepi32_ps(b), wxInv, wx);
+        const __m128 bottom = mixFloat(_mm_cvtepi32_ps(c), _mm_cvtepi32_ps(d), wxInv, wx);
+        return _mm_cvttps_epi32(mixFloat(top, bottom, wyInv, wy));
+    }
+}
+#endif
+
+// The float blend 16 bytes at a time, with the same float operations in the
+// same order as blendNodesFloatScalar. A compiler that fuses the scalar
+// multiply-adds could round differently in the last bit before truncation;
+// GridsInterpolationTest sweeps the grid to check the bytes still match
+inline void blendNodesFloat(const uint8_t* n00, const uint8_t* n01,
+                            const uint8_t* n10, const uint8_t* n11,
+                            float fx, float fy, uint8_t* out,
+                            size_t length = kNodeSize) {
+    size_t i = 0;
+
+#if GRIDS_INTERPOLATION_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 wx = _mm_set1_ps(fx);
+    const __m128 wxInv = _mm_set1_ps(1.0f - fx);
+    const __m128 wy = _mm_set1_ps(fy);
+    const __m128 wyInv = _mm_set1_ps(1.0f - fy);
+
+    // Widen 8 bytes of 16-bit lanes to two sets of 4 32-bit lanes
+    auto lo32 = [&](__m128i v) { return _mm_unpacklo_epi16(v, zero); };
+    auto hi32 = [&](__m128i v) { return _mm_unpackhi_epi16(v, zero); };
+
+    for (; i + 16 <= length; i += 16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n00 + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n01 + i));
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n10 + i));
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n11 + i));
+
+        __m128i halves[2];
+        for (int half = 0; half < 2; ++half) {
+            const __m128i a16 = half == 0 ? _mm_unpacklo_epi8(a, zero) : _mm_unpackhi_epi8(a, zero);
+            const __m128i b16 = half == 0 ? _mm_unpacklo_epi8(b, zero) : _mm_unpackhi_epi8(b, zero);
+            const __m128i c16 = half == 0 ? _mm_unpacklo_epi8(c, zero) : _mm_unpackhi_epi8(c, zero);
+            const __m128i d16 = half == 0 ? _mm_unpacklo_epi8(d, zero) : _mm_unpackhi_epi8(d, zero);
+
+            const __m128i lo = detail::blendFloat4(lo32(a16), lo32(b16), lo32(c16), lo32(d16), wxInv, wx, wyInv, wy);
+            const __m128i hi = detail::blendFloat4(hi32(a16), hi32(b16), hi32(c16), hi32(d16), wxInv, wx, wyInv, wy);
+            halves[half] = _mm_packs_epi32(lo, hi);  // Results are 0-255, so no lane saturates
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(halves[0], halves[1]));
+    }
+#elif GRIDS_INTERPOLATION_NEON
+    const float32x4_t wx = vdupq_n_f32(fx);
+    const float32x4_t wxInv = vdupq_n_f32(1.0f - fx);
+    const float32x4_t wy = vdupq_n_f32(fy);
+    const float32x4_t wyInv = vdupq_n_f32(1.0f - fy);
+
+    auto mix = [](float32x4_t a, float32x4_t b, float32x4_t inverse, float32x4_t weight) {
+        return vaddq_f32(vmulq_f32(a, inverse), vmulq_f32(b, weight));
+    };
+    auto toFloat = [](uint16x4_t v) { return vcvtq_f32_u32(vmovl_u16(v)); };
+    auto blend4 = [&](uint16x4_t a, uint16x4_t b, uint16x4_t c, uint16x4_t d) {
+        const float32x4_t top = mix(toFloat(a), toFloat(b), wxInv, wx);
+        const float32x4_t bottom = mix(toFloat(c), toFloat(d), wxInv, wx);
+        return vmovn_u32(vcvtq_u32_f32(mix(top, bottom, wyInv, wy)));
+    };
+    auto blend8 = [&](uint8x8_t a, uint8x8_t b, uint8x8_t c, uint8x8_t d) {
+        const uint16x8_t a16 = vmovl_u8(a), b16 = vmovl_u8(b), c16 = vmovl_u8(c), d16 = vmovl_u8(d);
+        return vmovn_u16(vcombine_u16(
+            blend4(vget_low_u16(a16), vget_low_u16(b16), vget_low_u16(c16), vget_low_u16(d16)),
+            blend4(vget_high_u16(a16), vget_high_u16(b16), vget_high_u16(c16), vget_high_u16(d16))));
+    };
+
+    for (; i + 16 <= length; i += 16) {
+        const uint8x16_t a = vld1q_u8(n00 + i);
+        const uint8x16_t b = vld1q_u8(n01 + i);
+        const uint8x16_t c = vld1q_u8(n10 + i);
+        const uint8x16_t d = vld1q_u8(n11 + i);
+
+        vst1q_u8(out + i, vcombine_u8(blend8(vget_low_u8(a), vget_low_u8(b), vget_low_u8(c), vget_low_u8(d)),
+                                      blend8(vget_high_u8(a), vget_high_u8(b), vget_high_u8(c), vget_high_u8(d))));
+    }
+#endif
+
+    // Scalar tail (or the whole node when no vector unit is available)
+    blendNodesFloatScalar(n00 + i, n01 + i, n10 + i, n11 + i, fx, fy, out + i, length - i);
+}
+
+// Compile-time checks for the fixed-point path. The firmware golden vectors
+// are checked at run time by GridsGoldenTest, from data generated outside C++
+namespace Verification {
+
+    // With both weights at zero a cell reads its corner node, scaled by 255/256
+    // once per crossfade as the firmware does - checked for every reachable node
+    constexpr bool checkNodeCorners() {
+        for (int nodeY = 0; nodeY < 4; ++nodeY)
+            for (int nodeX = 0; nodeX < 4; ++nodeX)
+                for (size_t offset = 0; offset < kNodeSize; ++offset) {
+                    const uint8_t node = (*node_table[nodeY * 5 + nodeX])[offset];
+                    const auto expected = u8Mix(u8Mix(node, 0, 0), 0, 0);
+                    if (readDrumMapFixedPoint(static_cast<uint8_t>(nodeX * 64),
+                                              static_cast<uint8_t>(nodeY * 64), offset) != expected)
+                        return false;
+                }
+        return true;
+    }
+
+    // The vector paths evaluate u8Mix in 16-bit lanes (SSE2 mullo/add/srli then
+    // packus, NEON mull/mlal then shrn), so they match the scalar bytes exactly as
+    // long as no sum wraps 16 bits and no mix leaves 0-255 before the narrowing.
+    // Checked for every weight at the extreme inputs; other inputs lie in between
+    constexpr bool checkVectorLaneRange() {
+        constexpr uint8_t extremes[] = { 0, 1, 254, 255 };
+        for (int balance = 0; balance < 256; ++balance)
+            for (const auto a : extremes)
+                for (const auto b : extremes) {
+                    const unsigned sum = a * (255u - balance) + b * static_cast<unsigned>(balance);
+                    if (sum > 0xFFFFu || (sum >> 8) > 255u)
+                        return false;
+                    if (u8Mix(a, b, static_cast<uint8_t>(balance)) != (sum >> 8))
+                        return false;
+                }
+        return true;
+    }
+
+    static_assert(checkVectorLaneRange(), "u8Mix no longer fits the 16-bit lanes of blendNodes");
+    static_assert(checkNodeCorners(), "Fixed-point interpolation does not land on the grid nodes");
+
+} // namespace Verification
+
+} // namespace grids
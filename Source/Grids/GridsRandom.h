@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+
+namespace grids {
+
+/**
+ * Counter-based random numbers for chaos.
+ *
+ * Each value is a pure function of (key, counter) using the SplitMix64
+ * mixer - there is no sequential generator state. Keys derived from one
+ * seed with different stream indices are independent, so every voice gets
+ * its own, and addressing by absolute step makes any position reproducible.
+ */
+
+constexpr uint64_t kGoldenGamma = 0x9E3779B97F4A7C15ull;
+
+// SplitMix64 output mixer
+constexpr uint64_t mix64(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// Random 64-bit value for a given key and counter
+constexpr uint64_t hash(uint64_t key, uint64_t counter) {
+    return mix64(key + (counter + 1) * kGoldenGamma);
+}
+
+// Key for an independent stream derived from a seed
+constexpr uint64_t streamKey(uint64_t seed, uint64_t stream) {
+    return mix64(seed ^ mix64((stream + 1) * kGoldenGamma));
+}
+
+// Top 24 bits as a float in [0, 1)
+constexpr float toUnitFloat(uint64_t value) {
+    return static_cast<float>(value >> 40) * (1.0f / 16777216.0f);
+}
+
+} // namespace grids
@@ -1,5 +1,7 @@
 #include "PluginProcessor.h"
 #include "Visage/GridsPluginEditor.h"
+#include "Settings/SettingsManager.h"
+#include "Utils/AllocationTrap.h"
 
 GridsAudioProcessor::GridsAudioProcessor()
      : AudioProcessor (BusesProperties()
@@ -9,15 +11,82 @@ GridsAudioProcessor::GridsAudioProcessor()
                       .withOutput ("Output", juce::AudioChannelSet::stereo(), true)),
        parameters(*this, nullptr, "GridsParameters", createParameterLayout())
 {
+    // Resolve every parameter ID once - the audio thread never looks them up by string
+    paramRefs.x = parameters.getRawParameterValue("x");
+    paramRefs.y = parameters.getRawParameterValue("y");
+    paramRefs.chaos = parameters.getRawParameterValue("chaos");
+    paramRefs.swing = parameters.getRawParameterValue("swing");
+    paramRefs.swingMode = parameters.getRawParameterValue("swing_mode");
+    paramRefs.clockSource = parameters.getRawParameterValue("clock_source");
+    paramRefs.internalBpm = parameters.getRawParameterValue("internal_bpm");
+    paramRefs.seed = parameters.getRawParameterValue("seed");
+    paramRefs.midiThru = parameters.getRawParameterValue("midi_thru");
+    paramRefs.liveMode = parameters.getRawParameterValue("live_mode");
+    paramRefs.midiChannel = parameters.getRawParameterValue("midi_channel");
+    paramRefs.reset = parameters.getRawParameterValue("reset");
+    paramRefs.resetMode = parameters.getRawParameterValue("reset_mode");
+    paramRefs.interpolation = parameters.getRawParameterValue("interpolation");
+    paramRefs.gateMode = parameters.getRawParameterValue("gate_mode");
+    paramRefs.gateLength = parameters.getRawParameterValue("gate_length");
+    paramRefs.noteReset = parameters.getRawParameterValue("note_reset");
+    paramRefs.noteFill = parameters.getRawParameterValue("note_fill");
+    paramRefs.bdDensity = parameters.getRawParameterValue("density_1_bd");
+    paramRefs.sdDensity = parameters.getRawParameterValue("density_2_sd");
+    paramRefs.hhDensity = parameters.getRawParameterValue("density_3_hh");
+#ifdef ENABLE_EUCLIDEAN_MODE
+    paramRefs.euclideanMode = parameters.getRawParameterValue("euclidean_mode");
+    paramRefs.euclideanLengths = { parameters.getRawParameterValue("euclid_length_1_bd"),
+                                   parameters.getRawParameterValue("euclid_length_2_sd"),
+                                   parameters.getRawParameterValue("euclid_length_3_hh") };
+    paramRefs.euclideanRotations = { parameters.getRawParameterValue("euclid_rotation_1_bd"),
+                                     parameters.getRawParameterValue("euclid_rotation_2_sd"),
+                                     parameters.getRawParameterValue("euclid_rotation_3_hh") };
+    paramRefs.euclideanAlgorithm = parameters.getRawParameterValue("euclid_algorithm");
+    paramRefs.euclideanAccentModes = { parameters.getRawParameterValue("euclid_accent_mode_1_bd"),
+                                       parameters.getRawParameterValue("euclid_accent_mode_2_sd"),
+                                       parameters.getRawParameterValue("euclid_accent_mode_3_hh") };
+    paramRefs.euclideanAccentValues = { parameters.getRawParameterValue("euclid_accent_value_1_bd"),
+                                        parameters.getRawParameterValue("euclid_accent_value_2_sd"),
+                                        parameters.getRawParameterValue("euclid_accent_value_3_hh") };
+    paramRefs.hybridMode = parameters.getRawParameterValue("hybrid_mode");
+    paramRefs.combineOps = { parameters.getRawParameterValue("combine_op_1_bd"),
+                             parameters.getRawParameterValue("combine_op_2_sd"),
+                             parameters.getRawParameterValue("combine_op_3_hh") };
+    paramRefs.combineBlends = { parameters.getRawParameterValue("combine_blend_1_bd"),
+                                parameters.getRawParameterValue("combine_blend_2_sd"),
+                                parameters.getRawParameterValue("combine_blend_3_hh") };
+#endif
+#ifdef ENABLE_VELOCITY_SYSTEM
+    paramRefs.bdVelocity = parameters.getRawParameterValue("velocity_1_bd");
+    paramRefs.sdVelocity = parameters.getRawParameterValue("velocity_2_sd");
+    paramRefs.hhVelocity = parameters.getRawParameterValue("velocity_3_hh");
+#endif
+    paramRefs.bdNote = parameters.getRawParameterValue("note_1_bd");
+    paramRefs.sdNote = parameters.getRawParameterValue("note_2_sd");
+    paramRefs.hhNote = parameters.getRawParameterValue("note_3_hh");
+    resetParameterIndex = parameters.getParameter("reset")->getParameterIndex();
+    
+    // Where a learned CC writes, by parameter index
+    for (auto* parameter : getParameters()) {
+        LearnTarget target;
+        if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(parameter)) {
+            target.value = parameters.getRawParameterValue(ranged->getParameterID());
+            target.range = ranged->getNormalisableRange();
+        }
+        learnTargets.push_back(target);
+    }
     
     // Initialize engine with parameter values
-    gridsEngine.setX(*parameters.getRawParameterValue("x"));
-    gridsEngine.setY(*parameters.getRawParameterValue("y"));
-    gridsEngine.setBDDensity(*parameters.getRawParameterValue("density_1_bd"));
-    gridsEngine.setSDDensity(*parameters.getRawParameterValue("density_2_sd"));
-    gridsEngine.setHHDensity(*parameters.getRawParameterValue("density_3_hh"));
-    gridsEngine.setChaos(*parameters.getRawParameterValue("chaos"));
-    gridsEngine.setSwing(*parameters.getRawParameterValue("swing"));
+    gridsEngine.setX(*paramRefs.x);
+    gridsEngine.setY(*paramRefs.y);
+    gridsEngine.setBDDensity(*paramRefs.bdDensity);
+    gridsEngine.setSDDensity(*paramRefs.sdDensity);
+    gridsEngine.setHHDensity(*paramRefs.hhDensity);
+    gridsEngine.setChaos(*paramRefs.chaos);
+    gridsEngine.setInterpolationMode(*paramRefs.interpolation > 0.5f
+                                         ? GridsEngine::InterpolationMode::FixedPoint
+                                         : GridsEngine::InterpolationMode::Float);
+    gridsEngine.setSeed(static_cast<uint32_t>(paramRefs.seed->load()));
 }
 
 GridsAudioProcessor::~GridsAudioProcessor()
@@ -43,12 +112,25 @@ juce::AudioProcessorValueTreeState::ParameterLayout GridsAudioProcessor::createP
     layout.add(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID("swing", 1), "Swing", 
         juce::NormalisableRange<float>(0.0f, 1.0f), 0.5f));
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID("swing_mode", 1), "Swing Mode",
+        juce::StringArray{"16th", "8th", "Triplet", "Groove"}, 0));
+    layout.add(std::make_unique<juce::AudioParameterInt>(
+        juce::ParameterID("seed", 1), "Chaos Seed",
+        0, 65535, 0));
     
     // Playback and MIDI settings
     layout.add(std::make_unique<juce::AudioParameterBool>(
         juce::ParameterID("midi_thru", 1), "MIDI Thru", true));
     layout.add(std::make_unique<juce::AudioParameterBool>(
         juce::ParameterID("live_mode", 1), "Live Mode", false));
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID("clock_source", 1), "Clock Source",
+        juce::StringArray{"Host", "Internal", "MIDI Clock"}, 0));
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("internal_bpm", 1), "Internal BPM",
+        juce::NormalisableRange<float>(20.0f, 300.0f, 0.01f), 120.0f,
+        juce::AudioParameterFloatAttributes().withLabel("BPM")));
     layout.add(std::make_unique<juce::AudioParameterInt>(
         juce::ParameterID("midi_channel", 1), "MIDI Channel", 
         1, 16, 1));
@@ -60,6 +142,24 @@ juce::AudioProcessorValueTreeState::ParameterLayout GridsAudioProcessor::createP
     layout.add(std::make_unique<juce::AudioParameterChoice>(
         juce::ParameterID("reset_mode", 1), "Reset Mode",
         juce::StringArray{"Transparent", "Retrigger"}, 0));
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID("note_reset", 1), "Note Reset", false));  // Incoming note-ons reset the pattern
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID("note_fill", 1), "Note Fill", false));    // Held incoming notes play a fill
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID("interpolation", 1), "Interpolation",
+        juce::StringArray{"Float", "Fixed-Point"}, 0));  // Fixed-Point renders bit-identically on every machine
+    
+    // Note length - Gate Mode holds each note until the next step, otherwise notes last Gate Length
+    auto& settings = SettingsManager::getInstance();
+    settings.initialise();
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID("gate_mode", 1), "Gate Mode",
+        settings.getBool(SettingsManager::Keys::defaultGateMode, true)));
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID("gate_length", 1), "Gate Length",
+        juce::NormalisableRange<float>(1.0f, 1000.0f, 0.0f, 0.4f), 50.0f,
+        juce::AudioParameterFloatAttributes().withLabel("ms")));
     
     // Density controls - using numeric IDs to force order
     layout.add(std::make_unique<juce::AudioParameterFloat>(
@@ -72,6 +172,59 @@ juce::AudioProcessorValueTreeState::ParameterLayout GridsAudioProcessor::createP
         juce::ParameterID("density_3_hh", 1), "HH Density", 
         juce::NormalisableRange<float>(0.0f, 1.0f), 0.5f));
     
+#ifdef ENABLE_EUCLIDEAN_MODE
+    // Euclidean mode - densities set the hit counts, per-voice lengths give polymeters
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID("euclidean_mode", 1), "Euclidean Mode",
+        settings.getBool(SettingsManager::Keys::preferEuclideanMode, false)));
+    
+    const std::array<std::pair<const char*, const char*>, GridsEngine::kNumDrumVoices> euclideanVoices {{
+        { "1_bd", "BD" }, { "2_sd", "SD" }, { "3_hh", "HH" }
+    }};
+    const std::array<const char*, GridsEngine::kNumDrumVoices> lengthKeys {
+        SettingsManager::Keys::euclideanBDLength, SettingsManager::Keys::euclideanSDLength,
+        SettingsManager::Keys::euclideanHHLength
+    };
+    const std::array<int, GridsEngine::kNumDrumVoices> defaultLengths { 16, 12, 8 };
+    
+    for (int voice = 0; voice < GridsEngine::kNumDrumVoices; ++voice) {
+        const juce::String suffix = euclideanVoices[voice].first;
+        const juce::String name = euclideanVoices[voice].second;
+        layout.add(std::make_unique<juce::AudioParameterInt>(
+            juce::ParameterID("euclid_length_" + suffix, 1), name + " Euclid Length",
+            1, EuclideanEngine::kMaxLength,
+            juce::jlimit(1, EuclideanEngine::kMaxLength, settings.getInt(lengthKeys[voice], defaultLengths[voice]))));
+        layout.add(std::make_unique<juce::AudioParameterInt>(
+            juce::ParameterID("euclid_rotation_" + suffix, 1), name + " Euclid Rotation",
+            0, EuclideanEngine::kMaxLength - 1, 0));
+        layout.add(std::make_unique<juce::AudioParameterChoice>(
+            juce::ParameterID("euclid_accent_mode_" + suffix, 1), name + " Euclid Accents",
+            juce::StringArray { "None", "Every Nth Hit", "Nested" }, 0));
+        layout.add(std::make_unique<juce::AudioParameterInt>(
+            juce::ParameterID("euclid_accent_value_" + suffix, 1), name + " Euclid Accent Value",
+            1, EuclideanEngine::kMaxLength, 2));  // N for every Nth hit, accent count when nested
+    }
+    
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID("euclid_algorithm", 1), "Euclid Algorithm",
+        juce::StringArray { "Even Spread", "Bjorklund" }, 0));
+    
+    // Hybrid mode - each voice combines its Grids and Euclidean masks (takes precedence over Euclidean mode)
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID("hybrid_mode", 1), "Hybrid Mode", false));
+    
+    for (int voice = 0; voice < GridsEngine::kNumDrumVoices; ++voice) {
+        const juce::String suffix = euclideanVoices[voice].first;
+        const juce::String name = euclideanVoices[voice].second;
+        layout.add(std::make_unique<juce::AudioParameterChoice>(
+            juce::ParameterID("combine_op_" + suffix, 1), name + " Combine",
+            juce::StringArray { "AND", "OR", "XOR", "AND NOT", "Blend" }, 1));
+        layout.add(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID("combine_blend_" + suffix, 1), name + " Combine Blend",
+            juce::NormalisableRange<float>(0.0f, 1.0f), 0.5f));
+    }
+#endif
+    
 #ifdef ENABLE_VELOCITY_SYSTEM
     // Velocity controls - mini knobs below density sliders
     layout.add(std::make_unique<juce::AudioParameterFloat>(
@@ -152,14 +305,28 @@ void GridsAudioProcessor::changeProgramName (int index, const juce::String& newN
 
 void GridsAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
-    juce::ignoreUnused (samplesPerBlock);
     currentSampleRate = sampleRate;
+    
+    // Reserve the output buffer for one thru event per sample plus the generated notes
+    midiBufferBytes = (samplesPerBlock + kMaxGeneratedEventsPerBlock) * kMidiEventBytes;
+    stagingMidi.ensureSize(static_cast<size_t>(midiBufferBytes));
+    
     gridsEngine.reset();
-    sampleCounter = 0;
+    freeRunClock.reset();
+    internalClock.reset();
+    midiClock.reset();
+    rampPrimed = false;
 }
 
 void GridsAudioProcessor::releaseResources()
 {
+   #if JUCE_DEBUG
+    // A full note-off queue falls back to holding notes until the next step,
+    // which shortens gates without any other sign. Report it where logging is safe
+    if (noteOffQueue.overflowCount() > 0)
+        DBG("Note-off queue overflowed " << (int) noteOffQueue.overflowCount()
+            << " times; those notes were held until the next step instead of gated");
+   #endif
 }
 
 bool GridsAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) const
@@ -178,47 +345,113 @@ bool GridsAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) co
 }
 
 void GridsAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
-                                        juce::MidiBuffer& midiMessages)
+                                        juce::MidiBuffer& hostMidi)
 {
-    juce::ignoreUnused (buffer);
+    const ScopedAllocationTrap allocationTrap;
+    
+    // Output is built in the storage reserved in prepareToPlay and swapped into
+    // the host's buffer at the end, so the host gets it without a copy. Hosts
+    // pass the same buffer every block (JUCE's wrappers keep one per plugin),
+    // which then comes back holding the reserved storage: swap it in again.
+    // Only a buffer with less room than ours is copied, into our storage. A host
+    // that passes a fresh, smaller buffer every block leaves us the smaller
+    // storage, and generating into it can allocate
+    auto& midiMessages = stagingMidi;
+    if (hostMidi.data.getNumAllocated() >= midiMessages.data.getNumAllocated()) {
+        midiMessages.swapWith(hostMidi);
+    } else {
+        midiMessages.clear();
+        midiMessages.addEvents(hostMidi, 0, -1, 0);
+    }
+    
+    // Absolute sample position of this block, used to time queued note-offs
+    blockStartSample += blockSize;
+    blockSize = buffer.getNumSamples();
+    const int numSamples = blockSize;
+    
+    // On every exit: release gates that end in this block, then hand the output to the host
+    const juce::ScopeGuard finishBlock { [&] {
+        freeRunClock.advance(blockSize);
+        releaseDueNotes(midiMessages, blockStartSample + blockSize);
+        hostMidi.swapWith(midiMessages);
+    } };
+    
+    // Process incoming MIDI for MIDI learn and CC control. Raw bytes only -
+    // building a MidiMessage would allocate for sysex. Events that act on the
+    // sequencer are collected with their sample offsets and applied in order
+    // while the block is generated
+    numControlEvents = 0;
+    const bool noteReset = *paramRefs.noteReset > 0.5f;
+    const bool noteFill = *paramRefs.noteFill > 0.5f;
+    if (!noteFill)
+        fillNotes.reset();
     
-    // Process incoming MIDI for MIDI learn and CC control
     for (const auto metadata : midiMessages)
     {
-        auto msg = metadata.getMessage();
+        const auto* data = metadata.data;
         
-        if (msg.isController())
-        {
-            int cc = msg.getControllerNumber();
-            float value = msg.getControllerValue() / 127.0f;
-            
-            // MIDI learn mode - learn the CC
-            if (midiLearnActive)
-            {
-                resetMidiCC = cc;
-                midiLearnActive = false;
-                DBG("Learned MIDI CC " + juce::String(cc) + " for reset");
-            }
-            // Check if this CC controls reset
-            else if (cc == resetMidiCC && resetMidiCC >= 0)
-            {
-                // Use CC value to control reset (>0.5 triggers)
-                if (auto* resetParam = parameters.getParameter("reset"))
-                {
-                    resetParam->setValueNotifyingHost(value);
-                }
-            }
+        // Clock, transport and song position feed the MIDI clock (it keeps the tempo
+        // locked in any mode, so switching to it doesn't need to relearn)
+        if (metadata.numBytes > 0 && (data[0] >= 0xf8 || data[0] == 0xf2)) {
+            midiClock.handleMessage(data, metadata.numBytes, blockStartSample + metadata.samplePosition);
+            continue;
+        }
+        
+        if (metadata.numBytes != 3)
+            continue;
+        
+        const int status = data[0] & 0xf0;
+        const bool isNoteOn = status == 0x90 && data[2] > 0;
+        const bool isNoteOff = status == 0x80 || (status == 0x90 && data[2] == 0);
+        if (noteFill && (isNoteOn || isNoteOff))
+            addControlEvent({ metadata.samplePosition, isNoteOn ? ControlEvent::FillOn : ControlEvent::FillOff,
+                              1.0f, data[1] });
+        if (isNoteOn && noteReset)
+            addControlEvent({ metadata.samplePosition, ControlEvent::NoteReset, 1.0f });
+        
+        if (status != 0xb0)
+            continue;
+        
+        int cc = data[1];
+        float value = data[2] / 127.0f;
+        
+        // Resolve the CC through the learn map (learning assigns it instead)
+        int parameterIndex = midiLearn.handleController(cc);
+        if (parameterIndex == MidiLearnMap::kNone)
+            continue;
+        
+        if (parameterIndex == resetParameterIndex) {
+            // Reset is edge-detected internally - the host never sees the CC
+            addControlEvent({ metadata.samplePosition, ControlEvent::ResetLevel, value });
+        } else {
+            addControlEvent({ metadata.samplePosition, ControlEvent::Parameter, value, parameterIndex });
         }
     }
     
-    // Get playhead info
-    auto playHead = getPlayHead();
-    if (!playHead) return;
+    // Get playhead info, from the host or from our own clock
+    const auto clockSource = static_cast<ClockSource>(static_cast<int>(*paramRefs.clockSource));
+    juce::AudioPlayHead::PositionInfo pos;
     
-    auto posInfo = playHead->getPosition();
-    if (!posInfo.hasValue()) return;
+    // The internal clock starts from the top whenever it's selected
+    if (clockSource != activeClockSource) {
+        internalClock.reset();
+        activeClockSource = clockSource;
+    }
     
-    auto pos = *posInfo;
+    if (clockSource == ClockSource::Host) {
+        auto playHead = getPlayHead();
+        auto posInfo = playHead != nullptr ? playHead->getPosition() : juce::Optional<juce::AudioPlayHead::PositionInfo>();
+        if (!posInfo.hasValue()) {
+            // No position to place them at, but resets still take effect
+            blockHasPpq = false;
+            applyControlEventsWithoutPlaying();
+            return;
+        }
+        
+        pos = *posInfo;
+    } else {
+        pos = getClockPosition(clockSource);
+    }
     
     // Get PPQ position for sync
     auto ppq = pos.getPpqPosition();
@@ -229,16 +462,31 @@ void GridsAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
     // Check if transport is playing or recording
     bool playing = pos.getIsPlaying();
     bool recording = pos.getIsRecording();
-    bool liveMode = *parameters.getRawParameterValue("live_mode") > 0.5f;
+    bool liveMode = *paramRefs.liveMode > 0.5f;
+    
+    // Block position, so resets inside the block land on their exact PPQ. Without a
+    // moving host position (no PPQ, or live mode with the transport stopped) steps
+    // follow the free-running clock at the host tempo; otherwise it tracks the host
+    // so switching between the two doesn't jump
+    blockPpqPerSample = pos.getBpm().hasValue() && *pos.getBpm() > 0
+        ? (*pos.getBpm() / 60.0) / currentSampleRate
+        : 0.0;
+    freeRunClock.setRate(blockPpqPerSample);
+    
+    freeRunning = !(ppq.hasValue() && (playing || recording));
+    if (!freeRunning)
+        freeRunClock.reset(*ppq);
+    
+    blockPpq = freeRunClock.getPpq();
+    blockHasPpq = ppq.hasValue() || freeRunning;
     
     // Don't generate MIDI during count-in (unless in live mode)
     if (inCountIn && !liveMode) {
         // During count-in: keep pattern at step 0, don't generate MIDI
-        if (wasInCountIn != inCountIn) {
+        if (wasInCountIn != inCountIn)
             gridsEngine.reset();
-            sampleCounter = 0;
-        }
         wasInCountIn = true;
+        applyControlEventsWithoutPlaying();
         return;
     }
     
@@ -247,82 +495,62 @@ void GridsAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
     if (wasInCountIn && !inCountIn) {
         // Just exited count-in, reset pattern to start
         gridsEngine.reset();
-        sampleCounter = 0;
         currentPatternStep = 0;
         justExitedCountIn = true;
     }
     wasInCountIn = inCountIn;
     
-    // Check for reset trigger BEFORE early return so it works when stopped
-    float currentResetValue = *parameters.getRawParameterValue("reset");
-    
-    // Combine with internal modulation if present
-#ifdef ENABLE_MODULATION_MATRIX
-    if (modulationMatrix.getModulation(ModulationMatrix::PATTERN_RESET) > 0.0f) {
-        currentResetValue = std::max(currentResetValue, 
-                                    modulationMatrix.getModulation(ModulationMatrix::PATTERN_RESET));
-    }
-#endif
-    
-    // Debug logging for reset
-    if (currentResetValue != lastResetValue) {
-        DBG("Reset value changed from " << lastResetValue << " to " << currentResetValue);
-    }
-    
-    // Trigger on rising edge crossing 0.5 threshold
-    if (lastResetValue < 0.5f && currentResetValue >= 0.5f) {
-        DBG("Reset triggered! Quantize mode: " << resetQuantize);
-        if (resetQuantize != QUANTIZE_OFF) {
-            resetArmed = true;  // Wait for quantize point
-            DBG("Reset armed, waiting for quantize point");
-        } else {
-            DBG("Executing immediate reset");
-            executeReset();     // Immediate
-        }
-    }
+    // Check for reset trigger BEFORE early return so it works when stopped.
+    // Incoming reset CCs and notes are applied later at their own sample offsets
+    detectResetEdge(0);
     
     // Check for quantized reset
     if (resetArmed && isQuantizePoint(pos, resetQuantize)) {
-        executeReset();
+        executeReset(0);
         resetArmed = false;
     }
     
-    // Store last value before auto-reset
-    lastResetValue = currentResetValue;
-    
     // Auto-reset parameter for button behavior (after processing the trigger)
-    // This keeps it momentary like a hardware button
-    if (currentResetValue > 0.5f) {
-        if (auto* resetParam = parameters.getParameter("reset")) {
-            // Use beginChangeGesture/endChangeGesture for proper automation
-            resetParam->beginChangeGesture();
-            resetParam->setValueNotifyingHost(0.0f);
-            resetParam->endChangeGesture();
-        }
+    // This keeps it momentary like a hardware button. The host is told from
+    // the message thread, as a complete gesture for proper automation
+    if (paramRefs.reset->load() > 0.5f && !resetReleasePosted) {
+        parameterNotifier.post(resetParameterIndex, 0.0f);
+        resetReleasePosted = true;
+    } else if (paramRefs.reset->load() <= 0.5f) {
+        resetReleasePosted = false;
     }
     
     // Generate MIDI when playing, recording, OR in live mode
     if (!playing && !recording && !liveMode) {
         isPlaying = false;
+        
+        // Nothing to interleave with while stopped
+        applyControlEventsWithoutPlaying();
+        
+        // Keep the engine and the display current while stopped
+        updateEngineParameters();
+        publishPattern();
         return;
     }
     
     // Reset on transport start or loop (but NOT if we just exited count-in)
     if (!justExitedCountIn && (!isPlaying || (ppq.hasValue() && *ppq < lastPpqPosition))) {
         gridsEngine.reset();
-        sampleCounter = 0;
         currentPatternStep = 0;
         hasResetOffset = false;  // Clear any reset offset on transport restart
         ppqOffsetAtReset = 0.0;
+        
+        // A free-running clock starts its bar here
+        if (freeRunning) {
+            freeRunClock.reset();
+            blockPpq = 0.0;
+        }
     }
     isPlaying = playing || recording || liveMode;
     
     if (ppq.hasValue())
         lastPpqPosition = *ppq;
     
-    // Update timing
-    updateTiming(pos);
-    
 #ifdef ENABLE_MODULATION_MATRIX
     // Update modulation LFOs
     if (pos.getBpm().hasValue() && *pos.getBpm() > 0)
@@ -334,294 +562,521 @@ void GridsAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
 #endif
     
     // Handle MIDI thru mode
-    bool midiThru = *parameters.getRawParameterValue("midi_thru") > 0.5f;
+    bool midiThru = *paramRefs.midiThru > 0.5f;
     if (!midiThru) {
         midiMessages.clear();  // Clear input if MIDI thru is disabled
     }
     // Otherwise preserve input MIDI and add our generated MIDI to it
     
+    updateEngineParameters();
+    publishPattern();
+    
+    // Handle retrigger at the beginning of the buffer if needed
+    fireRetrigger(midiMessages, 0);
+    
+    // Generate the block in segments split at the incoming control events, so
+    // a reset, fill or learned CC lands on its exact sample instead of the block start
+    int segmentStart = 0;
+    for (int i = 0; i <= numControlEvents; ++i) {
+        const int segmentEnd = i < numControlEvents ? juce::jlimit(segmentStart, numSamples, controlEvents[i].sample)
+                                                    : numSamples;
+        generateSteps(midiMessages, segmentStart, segmentEnd, justExitedCountIn && segmentStart == 0);
+        
+        if (i < numControlEvents) {
+            applyControlEvent(controlEvents[i]);
+            if (controlEvents[i].type == ControlEvent::Parameter)
+                updateEngineParameters(segmentEnd);
+            fireRetrigger(midiMessages, segmentEnd);
+        }
+        
+        segmentStart = segmentEnd;
+    }
+}
+
+void GridsAudioProcessor::generateSteps(juce::MidiBuffer& midiMessages, int startSample, int endSample,
+                                        bool justExitedCountIn)
+{
+    // Host and free-running clocks both arrive as a PPQ position; without a tempo there's nothing to play
+    if (!blockHasPpq || blockPpqPerSample <= 0.0)
+        return;
+    
+    double segmentPpq = blockPpq + startSample * blockPpqPerSample;
+    
+    // Step 0 sits at the reset point if there is one, otherwise at the song start
+    stepScheduler.setOrigin(hasResetOffset ? ppqOffsetAtReset : 0.0);
+    stepScheduler.setSwing(blockSwing,
+                           static_cast<StepScheduler::SwingMode>(static_cast<int>(*paramRefs.swingMode)));
+    
+    // Fire the step already sounding at the segment start if it's new, or if we
+    // just exited count-in and are at step 0
+    int64_t firstStep = stepScheduler.getStepAtPpq(segmentPpq);
+    int firstPatternStep = static_cast<int>(((firstStep % 32) + 32) % 32);
+    bool includeFirst = firstPatternStep != currentPatternStep
+                        || (justExitedCountIn && firstPatternStep == 0);
+    
+    // Jump straight to the sample offsets of the step boundaries in this segment
+    stepScheduler.processBlock(segmentPpq, blockPpqPerSample, endSample - startSample, includeFirst,
+                               [&](int sample, int64_t absoluteStep) {
+        // Move the GridsEngine to the new step. The absolute step index also
+        // addresses chaos, so the same position always plays the same notes
+        gridsEngine.setCurrentStep(absoluteStep);
+        currentPatternStep = gridsEngine.getCurrentStep();
+        
+        playStep(midiMessages, startSample + sample, absoluteStep);
+    });
+}
+
+void GridsAudioProcessor::fireRetrigger(juce::MidiBuffer& midiMessages, int sampleOffset)
+{
+    if (shouldRetrigger) {
+        // Evaluate drums at step 0 and trigger immediately
+        playStep(midiMessages, sampleOffset, gridsEngine.getAbsoluteStep());
+        shouldRetrigger = false;
+    }
+}
+
+void GridsAudioProcessor::addControlEvent(const ControlEvent& event)
+{
+    // When full, later events replace the last one so the final state still applies
+    controlEvents[static_cast<size_t>(juce::jmin(numControlEvents, kMaxControlEvents - 1))] = event;
+    numControlEvents = juce::jmin(numControlEvents + 1, kMaxControlEvents);
+}
+
+void GridsAudioProcessor::applyControlEventsWithoutPlaying()
+{
+    for (int i = 0; i < numControlEvents; ++i)
+        applyControlEvent(controlEvents[i]);
+    numControlEvents = 0;
+}
+
+void GridsAudioProcessor::applyControlEvent(const ControlEvent& event)
+{
+    switch (event.type) {
+        case ControlEvent::ResetLevel:
+            ccResetValue = event.value;
+            detectResetEdge(event.sample);
+            break;
+        case ControlEvent::NoteReset:
+            triggerReset(event.sample);
+            break;
+        case ControlEvent::Parameter:
+            applyLearnedController(event.index, event.value);
+            break;
+        case ControlEvent::FillOn:
+        case ControlEvent::FillOff:
+            // Steps pick the fill up through applyRampedParameters
+            fillNotes.set(static_cast<size_t>(event.index & 0x7f), event.type == ControlEvent::FillOn);
+            break;
+    }
+}
+
+void GridsAudioProcessor::detectResetEdge(int sampleOffset)
+{
+    // Sources are the parameter (automation or the UI button) and a learned CC
+    float currentResetValue = std::max(paramRefs.reset->load(), ccResetValue);
+    
+    // Combine with internal modulation if present
+#ifdef ENABLE_MODULATION_MATRIX
+    if (modulationMatrix.getModulation(ModulationMatrix::PATTERN_RESET) > 0.0f) {
+        currentResetValue = std::max(currentResetValue, 
+                                    modulationMatrix.getModulation(ModulationMatrix::PATTERN_RESET));
+    }
+#endif
+    
+    // Trigger on rising edge crossing 0.5 threshold
+    if (lastResetValue < 0.5f && currentResetValue >= 0.5f)
+        triggerReset(sampleOffset);
+    
+    lastResetValue = currentResetValue;
+}
+
+void GridsAudioProcessor::triggerReset(int sampleOffset)
+{
+    if (resetQuantize != QUANTIZE_OFF) {
+        resetArmed = true;  // Wait for quantize point
+    } else {
+        executeReset(sampleOffset);  // Immediate
+    }
+}
+
+void GridsAudioProcessor::updateEngineParameters(int midBlockSample)
+{
+    // Pick up a newly loaded groove template, or try again next block if it's being written
+    {
+        const juce::SpinLock::ScopedTryLockType lock(pendingGrooveLock);
+        if (lock.isLocked() && hasPendingGroove) {
+            groove = pendingGroove;
+            hasPendingGroove = false;
+            stepScheduler.setGrooveTiming(groove.timing);
+        }
+    }
+    
     // Get current parameter values and apply modulation
 #ifdef ENABLE_MODULATION_MATRIX
     // Apply modulation to parameters
     float xValue = modulationMatrix.applyModulation(ModulationMatrix::PATTERN_X, 
-                                                    *parameters.getRawParameterValue("x"));
+                                                    *paramRefs.x);
     float yValue = modulationMatrix.applyModulation(ModulationMatrix::PATTERN_Y,
-                                                    *parameters.getRawParameterValue("y"));
+                                                    *paramRefs.y);
     float bdDensity = modulationMatrix.applyModulation(ModulationMatrix::BD_DENSITY,
-                                                       *parameters.getRawParameterValue("density_1_bd"));
+                                                       *paramRefs.bdDensity);
     float sdDensity = modulationMatrix.applyModulation(ModulationMatrix::SD_DENSITY,
-                                                       *parameters.getRawParameterValue("density_2_sd"));
+                                                       *paramRefs.sdDensity);
     float hhDensity = modulationMatrix.applyModulation(ModulationMatrix::HH_DENSITY,
-                                                       *parameters.getRawParameterValue("density_3_hh"));
+                                                       *paramRefs.hhDensity);
     float chaos = modulationMatrix.applyModulation(ModulationMatrix::CHAOS,
-                                                   *parameters.getRawParameterValue("chaos"));
+                                                   *paramRefs.chaos);
     float swing = modulationMatrix.applyModulation(ModulationMatrix::SWING,
-                                                   *parameters.getRawParameterValue("swing"));
+                                                   *paramRefs.swing);
     
-    gridsEngine.setX(xValue);
-    gridsEngine.setY(yValue);
-    gridsEngine.setBDDensity(bdDensity);
-    gridsEngine.setSDDensity(sdDensity);
-    gridsEngine.setHHDensity(hhDensity);
+    const RampValues targets { xValue, yValue, bdDensity, sdDensity, hhDensity };
     gridsEngine.setChaos(chaos);
-    gridsEngine.setSwing(swing);
+    blockSwing = swing;
 #else
     // Get current parameter values without modulation
-    gridsEngine.setX(*parameters.getRawParameterValue("x"));
-    gridsEngine.setY(*parameters.getRawParameterValue("y"));
-    gridsEngine.setBDDensity(*parameters.getRawParameterValue("density_1_bd"));
-    gridsEngine.setSDDensity(*parameters.getRawParameterValue("density_2_sd"));
-    gridsEngine.setHHDensity(*parameters.getRawParameterValue("density_3_hh"));
-    gridsEngine.setChaos(*parameters.getRawParameterValue("chaos"));
-    gridsEngine.setSwing(*parameters.getRawParameterValue("swing"));
+    const RampValues targets { paramRefs.x->load(), paramRefs.y->load(), paramRefs.bdDensity->load(),
+                               paramRefs.sdDensity->load(), paramRefs.hhDensity->load() };
+    gridsEngine.setChaos(*paramRefs.chaos);
+    blockSwing = *paramRefs.swing;
 #endif
     
+    // X/Y and densities ramp across the block from where the previous block
+    // left them, so automation doesn't jump in buffer-sized stairs. That puts
+    // them up to one block behind the host: a value set for this block is only
+    // reached at its end. They snap while stopped, when there's nothing to play
+    // between the two values. Mid-block, a parameter a learned CC just moved
+    // holds its new value from there
+    if (midBlockSample < 0) {
+        rampStart = isPlaying && rampPrimed ? rampEnd : targets;
+        rampEnd = targets;
+        rampPrimed = true;
+        applyRampedParameters(0);
+    } else {
+        for (size_t i = 0; i < targets.size(); ++i)
+            if (targets[i] != rampEnd[i])
+                rampStart[i] = rampEnd[i] = targets[i];
+        applyRampedParameters(midBlockSample);
+    }
+    
     // Get MIDI settings
-    bdNote = *parameters.getRawParameterValue("note_1_bd");
-    sdNote = *parameters.getRawParameterValue("note_2_sd");
-    hhNote = *parameters.getRawParameterValue("note_3_hh");
+    const std::array<std::atomic<float>*, GridsEngine::kNumDrumVoices> noteParams {
+        paramRefs.bdNote, paramRefs.sdNote, paramRefs.hhNote
+    };
     
+    for (int voice = 0; voice < GridsEngine::kNumDrumVoices; ++voice) {
+        voiceNotes[voice] = static_cast<int>(*noteParams[voice]);
+        
 #ifdef ENABLE_MODULATION_MATRIX
-    // Apply MIDI note modulation
-    float bdNoteModulation = modulationMatrix.getModulation(ModulationMatrix::BD_MIDI_NOTE);
-    float sdNoteModulation = modulationMatrix.getModulation(ModulationMatrix::SD_MIDI_NOTE);
-    float hhNoteModulation = modulationMatrix.getModulation(ModulationMatrix::HH_MIDI_NOTE);
-    
-    // Apply modulation to MIDI notes (± 12 semitones range)
-    bdNote = juce::jlimit(0.0f, 127.0f, bdNote + (bdNoteModulation * 12.0f));
-    sdNote = juce::jlimit(0.0f, 127.0f, sdNote + (sdNoteModulation * 12.0f));
-    hhNote = juce::jlimit(0.0f, 127.0f, hhNote + (hhNoteModulation * 12.0f));
+        // Apply MIDI note modulation (± 12 semitones range)
+        auto destination = static_cast<ModulationMatrix::Destination>(ModulationMatrix::BD_MIDI_NOTE + voice);
+        float noteModulation = modulationMatrix.getModulation(destination);
+        voiceNotes[voice] = static_cast<int>(juce::jlimit(0.0f, 127.0f, voiceNotes[voice] + (noteModulation * 12.0f)));
 #endif
+    }
     
-    midiChannel = *parameters.getRawParameterValue("midi_channel");
+    midiChannel = *paramRefs.midiChannel;
     
-    // Process each sample in the buffer - PPQ-based sync
-    int numSamples = buffer.getNumSamples();
+    // Gate length in samples (0 = hold until the next step)
+    gateSamples = *paramRefs.gateMode > 0.5f
+        ? 0
+        : juce::jmax<int64_t>(1, static_cast<int64_t>(*paramRefs.gateLength * 0.001 * currentSampleRate));
     
-    // Handle retrigger at the beginning of the buffer if needed
-    if (shouldRetrigger) {
-        // Evaluate drums at step 0 and trigger immediately
-        gridsEngine.evaluateDrums();
-        if (gridsEngine.getBDTrigger()) {
-            int velocity = calculateVelocity(true, gridsEngine.getBDAccent(), "bd");
-            addMidiNote(midiMessages, 0, bdNote, true, velocity);
-        }
-        if (gridsEngine.getSDTrigger()) {
-            int velocity = calculateVelocity(false, gridsEngine.getSDAccent(), "sd");
-            addMidiNote(midiMessages, 0, sdNote, true, velocity);
-        }
-        if (gridsEngine.getHHTrigger()) {
-            int velocity = calculateVelocity(false, gridsEngine.getHHAccent(), "hh");
-            addMidiNote(midiMessages, 0, hhNote, true, velocity);
-        }
-        shouldRetrigger = false;
+    // Velocity table for this block - note-ons only look it up
+    updateVelocityTable();
+    
+#ifdef ENABLE_EUCLIDEAN_MODE
+    // Euclidean masks are only rebuilt when a length, rotation, hit count or accent setting changes,
+    // hybrid masks when the pattern changes or a new 32-step window starts
+    gridsEngine.setPatternMode(*paramRefs.hybridMode > 0.5f      ? GridsEngine::PatternMode::Hybrid
+                               : *paramRefs.euclideanMode > 0.5f ? GridsEngine::PatternMode::Euclidean
+                                                                 : GridsEngine::PatternMode::Grids);
+    gridsEngine.setEuclideanAlgorithm(static_cast<EuclideanEngine::Algorithm>(static_cast<int>(*paramRefs.euclideanAlgorithm)));
+    for (int voice = 0; voice < GridsEngine::kNumDrumVoices; ++voice) {
+        gridsEngine.setEuclideanLength(voice, static_cast<int>(*paramRefs.euclideanLengths[voice]));
+        gridsEngine.setEuclideanRotation(voice, static_cast<int>(*paramRefs.euclideanRotations[voice]));
+        gridsEngine.setEuclideanAccent(voice,
+                                       static_cast<EuclideanEngine::AccentMode>(static_cast<int>(*paramRefs.euclideanAccentModes[voice])),
+                                       static_cast<int>(*paramRefs.euclideanAccentValues[voice]));
+        gridsEngine.setCombineOp(voice, static_cast<GridsEngine::CombineOp>(static_cast<int>(*paramRefs.combineOps[voice])));
+        gridsEngine.setCombineBlend(voice, *paramRefs.combineBlends[voice]);
     }
+#endif
     
-    // Use PPQ-based synchronization if available
-    if (ppq.hasValue() && pos.getBpm().hasValue() && *pos.getBpm() > 0) {
-        double currentPpq = *ppq;
-        double bpm = *pos.getBpm();
-        double samplesPerBeat = (currentSampleRate * 60.0) / bpm;
-        double samplesPerSixteenth = samplesPerBeat / 4.0;
+    gridsEngine.setInterpolationMode(*paramRefs.interpolation > 0.5f
+                                         ? GridsEngine::InterpolationMode::FixedPoint
+                                         : GridsEngine::InterpolationMode::Float);
+    
+    // Only reseed when the seed actually changes, otherwise the streams would restart every block
+    auto seed = static_cast<uint32_t>(paramRefs.seed->load());
+    if (seed != gridsEngine.getSeed())
+        gridsEngine.setSeed(seed);
+}
+
+void GridsAudioProcessor::applyLearnedController(int parameterIndex, float normalisedValue)
+{
+    // The value the audio thread reads changes at the CC's own sample, even when
+    // the message thread isn't running (offline renders). The host hears about
+    // it from the notifier's timer
+    if (parameterIndex < 0 || parameterIndex >= static_cast<int>(learnTargets.size()))
+        return;
+    
+    const auto& target = learnTargets[static_cast<size_t>(parameterIndex)];
+    if (target.value != nullptr)
+        target.value->store(target.range.snapToLegalValue(target.range.convertFrom0to1(normalisedValue)));
+    
+    parameterNotifier.post(parameterIndex, normalisedValue);
+}
+
+void GridsAudioProcessor::renderLookahead(int64_t step)
+{
+    // Render the whole bar containing the step in one pass
+    int64_t barStart = step - (((step % kLookaheadSteps) + kLookaheadSteps) % kLookaheadSteps);
+    
+    numLookaheadEvents = gridsEngine.renderSteps(barStart, kLookaheadSteps, lookaheadEvents.data(),
+                                                 static_cast<int>(lookaheadEvents.size()));
+    lookaheadStart = barStart;
+    lookaheadVersion = gridsEngine.getPatternVersion();
+    lookaheadValid = true;
+    lookaheadPublished = false;
+}
+
+void GridsAudioProcessor::publishLookahead()
+{
+    // One record per voice, bit i = step lookaheadStart + i. Like the pattern
+    // masks, all voices go out together or not at all
+    const int numVoices = gridsEngine.getNumVoices();
+    if (lookaheadPublished || !telemetryActive.load(std::memory_order_relaxed) || !telemetry.hasSpaceFor(numVoices))
+        return;
+    
+    std::array<TelemetryEvent, GridsEngine::kMaxVoices> records {};
+    for (int voice = 0; voice < numVoices; ++voice) {
+        auto& record = records[static_cast<size_t>(voice)];
+        record.type = TelemetryEvent::Lookahead;
+        record.voice = static_cast<uint8_t>(voice);
+        record.step = static_cast<uint8_t>(((lookaheadStart % 32) + 32) % 32);
+    }
+    
+    for (int i = 0; i < numLookaheadEvents; ++i) {
+        const auto& event = lookaheadEvents[i];
+        if (event.voice >= numVoices) continue;
         
-        // Calculate samples per PPQ unit
-        double ppqPerSample = (bpm / 60.0) / currentSampleRate;
+        records[event.voice].triggers |= 1u << static_cast<int>(event.step - lookaheadStart);
+    }
+    
+    for (int voice = 0; voice < numVoices; ++voice)
+        telemetry.push(records[static_cast<size_t>(voice)]);
+    lookaheadPublished = true;
+}
+
+void GridsAudioProcessor::applyRampedParameters(int sampleOffset)
+{
+    // Setters only invalidate the pattern when a value actually changes
+    const float t = blockSize > 0 ? static_cast<float>(sampleOffset) / static_cast<float>(blockSize) : 0.0f;
+    const auto at = [&](int index) { return rampStart[index] + (rampEnd[index] - rampStart[index]) * t; };
+    
+    // A moving X/Y rebuilds the pattern levels, so mid-ramp positions step along
+    // the 8-bit grid the Fixed-Point mode reads: consecutive steps of a slow ramp
+    // share a position and the levels are rebuilt only when it moves. A settled
+    // value is applied exactly
+    const auto position = [&](int index) {
+        return rampStart[index] == rampEnd[index] ? rampEnd[index] : std::round(at(index) * 255.0f) / 255.0f;
+    };
+    gridsEngine.setX(position(RampX));
+    gridsEngine.setY(position(RampY));
+    
+    // A held fill note raises every density on top of the ramp
+    const float fill = fillNotes.any() ? kFillDensityBoost : 0.0f;
+    gridsEngine.setBDDensity(juce::jmin(1.0f, at(RampBDDensity) + fill));
+    gridsEngine.setSDDensity(juce::jmin(1.0f, at(RampSDDensity) + fill));
+    gridsEngine.setHHDensity(juce::jmin(1.0f, at(RampHHDensity) + fill));
+}
+
+void GridsAudioProcessor::playStep(juce::MidiBuffer& midiMessages, int sampleOffset, int64_t step)
+{
+    // Each step sees the X/Y and densities of its own position in the block
+    applyRampedParameters(sampleOffset);
+    
+    // Re-render when the step leaves the current bar or the pattern has changed
+    if (!lookaheadValid || step < lookaheadStart || step >= lookaheadStart + kLookaheadSteps
+        || lookaheadVersion != gridsEngine.getPatternVersion())
+        renderLookahead(step);
+    
+    // Fixed gates ending at or before this step go out first, so a note is
+    // released before the same voice sounds again
+    const int64_t stepSample = blockStartSample + sampleOffset;
+    releaseDueNotes(midiMessages, stepSample + 1);
+    
+    // Generate note offs for notes held since the previous step. A retrigger
+    // replays a step, so its held notes have to be released here as well
+    for (int voice = 0; voice < static_cast<int>(voiceNotes.size()); ++voice) {
+        if ((soundingTriggers >> voice) & 1u)
+            addMidiNote(midiMessages, sampleOffset, voiceNotes[voice], false, 0);
+    }
+    
+    // Generate note ons for this step's events
+    soundingTriggers = 0;
+    
+    TelemetryEvent telemetryEvent;
+    telemetryEvent.type = TelemetryEvent::Step;
+    telemetryEvent.step = static_cast<uint8_t>(((step % 32) + 32) % 32);
+    // Groove mode also scales velocities per step
+    const bool grooveVelocity = static_cast<int>(*paramRefs.swingMode) == static_cast<int>(StepScheduler::SwingMode::Groove);
+    
+    for (int i = 0; i < numLookaheadEvents; ++i) {
+        const auto& event = lookaheadEvents[i];
+        if (event.step < step) continue;
+        if (event.step > step) break;
+        if (event.voice >= voiceNotes.size()) continue;
         
-        for (int sample = 0; sample < numSamples; ++sample) {
-            // Calculate the PPQ position for this sample
-            double samplePpq = currentPpq + (sample * ppqPerSample);
-            
-            // Apply swing adjustment
-            double swingValue = *parameters.getRawParameterValue("swing");
-            double adjustedPpq = samplePpq;
-            
-            if (swingValue != 0.5f) {
-                // Calculate position within a beat (0-1)
-                double beatPosition = std::fmod(samplePpq, 1.0);
-                
-                // Apply swing to 2nd and 4th sixteenth notes (0.25 and 0.75 within beat)
-                // Swing shifts odd 16th notes later (>0.5) or earlier (<0.5)
-                double swingOffset = (swingValue - 0.5f) * 0.1;  // Max ±10% of a 16th note
-                
-                // Check if we're near an odd 16th note
-                if ((beatPosition > 0.20 && beatPosition < 0.30) ||  // 2nd 16th
-                    (beatPosition > 0.70 && beatPosition < 0.80)) {  // 4th 16th
-                    adjustedPpq += swingOffset;
-                }
-            }
-            
-            // Calculate which 16th note step we should be on (32 steps = 2 bars = 8 beats)
-            // If we have a reset offset, calculate relative to that point
-            double ppqForStep = adjustedPpq;
-            if (hasResetOffset) {
-                ppqForStep = adjustedPpq - ppqOffsetAtReset;
-                // Ensure positive value for step calculation
-                while (ppqForStep < 0) ppqForStep += 8.0; // Add 2 bars worth of PPQ
-            }
-            
-            // PPQ 0 = bar 1, beat 1 should map to step 0
-            // PPQ 8 = bar 3, beat 1 should map to step 0 (wraps around after 2 bars)
-            int targetStep = static_cast<int>(ppqForStep * 4.0) % 32;
-            if (targetStep < 0) targetStep = 0;  // Handle negative PPQ during count-in
-            
-            
-            // Check if we need to advance to the next step
-            // Also force evaluation if we just exited count-in and are at step 0
-            if (targetStep != currentPatternStep || (justExitedCountIn && targetStep == 0 && sample == 0)) {
-                // Store previous trigger states
-                bool prevBD = gridsEngine.getBDTrigger();
-                bool prevSD = gridsEngine.getSDTrigger();
-                bool prevHH = gridsEngine.getHHTrigger();
-                
-                // Advance to the target step
-                // Set the GridsEngine to the correct step and evaluate
-                gridsEngine.setCurrentStep(targetStep);
-                gridsEngine.evaluateDrums();
-                currentPatternStep = targetStep;
-                
-                // Generate note offs for previous triggers
-                if (prevBD) addMidiNote(midiMessages, sample, bdNote, false, 0);
-                if (prevSD) addMidiNote(midiMessages, sample, sdNote, false, 0);
-                if (prevHH) addMidiNote(midiMessages, sample, hhNote, false, 0);
-                
-                // Generate note ons for new triggers
-                if (gridsEngine.getBDTrigger()) {
-                    int velocity = calculateVelocity(true, gridsEngine.getBDAccent(), "bd");
-                    addMidiNote(midiMessages, sample, bdNote, true, velocity);
-                }
-                if (gridsEngine.getSDTrigger()) {
-                    int velocity = calculateVelocity(false, gridsEngine.getSDAccent(), "sd");
-                    addMidiNote(midiMessages, sample, sdNote, true, velocity);
-                }
-                if (gridsEngine.getHHTrigger()) {
-                    int velocity = calculateVelocity(false, gridsEngine.getHHAccent(), "hh");
-                    addMidiNote(midiMessages, sample, hhNote, true, velocity);
-                }
-            }
+        const uint32_t voiceBit = 1u << event.voice;
+        const int note = voiceNotes[event.voice];
+        
+        // A gate longer than the step is cut short; its queued note-off goes stale
+        if (gatedVoices & voiceBit) {
+            addMidiNote(midiMessages, sampleOffset, note, false, 0);
+            gatedVoices &= ~voiceBit;
         }
-    } else {
-        // Fallback to sample counting if no PPQ available
-        for (int sample = 0; sample < numSamples; ++sample) {
-            // Check if we should tick the pattern
-            if (samplesPerClock > 0 && ++sampleCounter >= samplesPerClock) {
-                sampleCounter = 0;
-                
-                // Store previous trigger states
-                bool prevBD = gridsEngine.getBDTrigger();
-                bool prevSD = gridsEngine.getSDTrigger();
-                bool prevHH = gridsEngine.getHHTrigger();
-                
-                // Advance pattern
-                gridsEngine.tick();
-                currentPatternStep = (currentPatternStep + 1) % 32;
-                
-                // Generate note offs for previous triggers
-                if (prevBD) addMidiNote(midiMessages, sample, bdNote, false, 0);
-                if (prevSD) addMidiNote(midiMessages, sample, sdNote, false, 0);
-                if (prevHH) addMidiNote(midiMessages, sample, hhNote, false, 0);
-                
-                // Generate note ons for new triggers
-                if (gridsEngine.getBDTrigger()) {
-                    int velocity = calculateVelocity(true, gridsEngine.getBDAccent(), "bd");
-                    addMidiNote(midiMessages, sample, bdNote, true, velocity);
-                }
-                if (gridsEngine.getSDTrigger()) {
-                    int velocity = calculateVelocity(false, gridsEngine.getSDAccent(), "sd");
-                    addMidiNote(midiMessages, sample, sdNote, true, velocity);
-                }
-                if (gridsEngine.getHHTrigger()) {
-                    int velocity = calculateVelocity(false, gridsEngine.getHHAccent(), "hh");
-                    addMidiNote(midiMessages, sample, hhNote, true, velocity);
-                }
-            }
+        
+        const int velocity = grooveVelocity
+            ? juce::jlimit(1, 127, juce::roundToInt(event.velocity * groove.getVelocityScale(step)))
+            : event.velocity;
+        addMidiNote(midiMessages, sampleOffset, note, true, velocity);
+        
+        // Queue the note-off, or hold until the next step in Gate Mode (or if the queue is full)
+        const uint32_t id = ++voiceNoteIds[event.voice];
+        if (gateSamples > 0
+            && noteOffQueue.push({ stepSample + gateSamples, id, event.voice,
+                                   static_cast<uint8_t>(midiChannel), static_cast<uint8_t>(note) })) {
+            gatedVoices |= voiceBit;
+        } else {
+            soundingTriggers |= voiceBit;
         }
+        
+        telemetryEvent.triggers |= voiceBit;
+        if (event.accent)
+            telemetryEvent.accents |= voiceBit;
+        telemetryEvent.velocities[event.voice] = static_cast<uint8_t>(velocity);
     }
+    
+    if (telemetryActive.load(std::memory_order_relaxed))
+        telemetry.push(telemetryEvent);
+    publishLookahead();
 }
 
-void GridsAudioProcessor::updateTiming(const juce::AudioPlayHead::PositionInfo& posInfo)
+void GridsAudioProcessor::publishPattern()
 {
-    // Calculate samples per 16th note (Grids uses 32 steps = 2 bars)
-    if (posInfo.getBpm().hasValue() && *posInfo.getBpm() > 0) {
-        double bpm = *posInfo.getBpm();
-        double beatsPerSecond = bpm / 60.0;
-        double sixteenthsPerSecond = beatsPerSecond * 4.0;  // 4 sixteenths per beat
-        double samplesPerSixteenth = currentSampleRate / sixteenthsPerSecond;
-        
-        // Grids advances once per 16th note
-        samplesPerClock = static_cast<int>(samplesPerSixteenth);
+    // Pattern records go out whenever the engine's output changes, the playhead moves
+    // into a window with different masks (or the editor asks), and only as a complete
+    // set so the display never shows half an update
+    // Nothing drains the queue without an editor; it republishes when it opens
+    if (!telemetryActive.load(std::memory_order_relaxed))
+        return;
+    
+    const uint32_t version = gridsEngine.getPatternVersion();
+    const int64_t window = gridsEngine.getPatternWindow();
+    if (version == publishedPatternVersion && window == publishedPatternWindow
+        && !patternRefreshRequested.load(std::memory_order_relaxed))
+        return;
+    
+    const int numVoices = gridsEngine.getNumVoices();
+    if (!telemetry.hasSpaceFor(numVoices))
+        return;
+    
+    for (int voice = 0; voice < numVoices; ++voice) {
+        TelemetryEvent event;
+        event.type = TelemetryEvent::Pattern;
+        event.voice = static_cast<uint8_t>(voice);
+        event.numVoices = static_cast<uint8_t>(numVoices);
+        event.triggers = gridsEngine.getTriggerMask(voice);
+        event.accents = gridsEngine.getAccentMask(voice);
+        telemetry.push(event);
     }
+    
+    publishedPatternVersion = version;
+    publishedPatternWindow = window;
+    if (patternRefreshRequested.load(std::memory_order_relaxed))
+        lookaheadPublished = false;  // A fresh editor needs the upcoming hits as well
+    patternRefreshRequested.store(false, std::memory_order_relaxed);
+}
+
+void GridsAudioProcessor::releaseDueNotes(juce::MidiBuffer& midiMessages, int64_t endSample)
+{
+    noteOffQueue.popDue(endSample, [&](const auto& entry) {
+        // Skip note-offs for notes that were already cut short by a retrigger
+        if (entry.id != voiceNoteIds[entry.voice] || !((gatedVoices >> entry.voice) & 1u))
+            return;
+        
+        gatedVoices &= ~(1u << entry.voice);
+        auto offset = static_cast<int>(juce::jmax<int64_t>(0, entry.sampleTime - blockStartSample));
+        addNoteMessage(midiMessages, offset, entry.channel, entry.note, false, 0);
+    });
 }
 
-void GridsAudioProcessor::addMidiNote(juce::MidiBuffer& midiMessages, int sampleOffset,
+void GridsAudioProcessor::addMidiNote(juce::MidiBuffer& midiMessages, int sampleOffset, 
                                       int noteNumber, bool noteOn, int velocity)
 {
-    juce::MidiMessage msg = noteOn 
-        ? juce::MidiMessage::noteOn(midiChannel, noteNumber, (juce::uint8)velocity)
-        : juce::MidiMessage::noteOff(midiChannel, noteNumber);
+    addNoteMessage(midiMessages, sampleOffset, midiChannel, noteNumber, noteOn, velocity);
+}
+
+void GridsAudioProcessor::addNoteMessage(juce::MidiBuffer& midiMessages, int sampleOffset,
+                                         int channel, int noteNumber, bool noteOn, int velocity)
+{
+    // Raw 3-byte message straight into the reserved buffer - no MidiMessage on the audio thread
+    const juce::uint8 bytes[] = {
+        static_cast<juce::uint8>((noteOn ? 0x90 : 0x80) | ((channel - 1) & 0x0f)),
+        static_cast<juce::uint8>(noteNumber & 0x7f),
+        static_cast<juce::uint8>(noteOn ? (velocity & 0x7f) : 0)
+    };
     
-    midiMessages.addEvent(msg, sampleOffset);
+    midiMessages.addEvent(bytes, 3, sampleOffset);
 }
 
-int GridsAudioProcessor::calculateVelocity(bool isBD, bool isAccent, const juce::String& voice)
+void GridsAudioProcessor::updateVelocityTable()
 {
 #ifdef ENABLE_VELOCITY_SYSTEM
-    // Get velocity range parameter (0.0 = narrow range, 1.0 = wide range)
-    float velocityRange = 0.5f;
-    if (voice == "bd")
-        velocityRange = *parameters.getRawParameterValue("velocity_1_bd");
-    else if (voice == "sd")
-        velocityRange = *parameters.getRawParameterValue("velocity_2_sd");
-    else if (voice == "hh")
-        velocityRange = *parameters.getRawParameterValue("velocity_3_hh");
+    std::atomic<float>* velocityParams[] = { paramRefs.bdVelocity, paramRefs.sdVelocity, paramRefs.hhVelocity };
+    float chaos = *paramRefs.chaos;
     
+    for (int voice = 0; voice < 3; ++voice)
+    {
+        // Get velocity range parameter (0.0 = narrow range, 1.0 = wide range)
+        float velocityRange = *velocityParams[voice];
+        
 #ifdef ENABLE_MODULATION_MATRIX
-    // Apply velocity modulation
-    float velocityModulation = 0.0f;
-    if (voice == "bd")
-        velocityModulation = modulationMatrix.getModulation(ModulationMatrix::BD_VELOCITY);
-    else if (voice == "sd")
-        velocityModulation = modulationMatrix.getModulation(ModulationMatrix::SD_VELOCITY);
-    else if (voice == "hh")
-        velocityModulation = modulationMatrix.getModulation(ModulationMatrix::HH_VELOCITY);
-    
-    // Apply modulation to velocity range
-    velocityRange = juce::jlimit(0.0f, 1.0f, velocityRange + velocityModulation);
+        // Apply velocity modulation (BD/SD/HH velocity destinations are consecutive)
+        auto destination = static_cast<ModulationMatrix::Destination>(ModulationMatrix::BD_VELOCITY + voice);
+        velocityRange = juce::jlimit(0.0f, 1.0f, velocityRange + modulationMatrix.getModulation(destination));
 #endif
-    
-    // Calculate base velocities based on range
-    // Range goes from narrow (80-100) to wide (40-127)
-    int minVel = static_cast<int>(80 - (velocityRange * 40));  // 80 -> 40
-    int maxVel = static_cast<int>(100 + (velocityRange * 27)); // 100 -> 127
-    int normalVel = (minVel + maxVel) / 2;
-    
-    // Apply accent
-    if (isAccent) {
-        return maxVel;
-    }
-    
-    // Add slight variation based on chaos parameter
-    float chaos = *parameters.getRawParameterValue("chaos");
-    if (chaos > 0.0f) {
-        // Add random variation based on chaos (up to ±15% of range)
-        int range = maxVel - minVel;
-        int variation = static_cast<int>((juce::Random::getSystemRandom().nextFloat() - 0.5f) * range * chaos * 0.3f);
-        normalVel = juce::jlimit(minVel, maxVel, normalVel + variation);
-    }
-    
-    // BD typically louder than other drums
-    if (isBD) {
-        normalVel = juce::jmin(127, normalVel + 10);
+        
+        // Calculate base velocities based on range
+        // Range goes from narrow (80-100) to wide (40-127)
+        int minVel = static_cast<int>(80 - (velocityRange * 40));  // 80 -> 40
+        int maxVel = static_cast<int>(100 + (velocityRange * 27)); // 100 -> 127
+        
+        GridsEngine::VoiceVelocity velocity;
+        velocity.normal = static_cast<uint8_t>((minVel + maxVel) / 2);
+        velocity.accent = static_cast<uint8_t>(maxVel);
+        velocity.min = static_cast<uint8_t>(minVel);
+        velocity.max = static_cast<uint8_t>(maxVel);
+        
+        // Slight variation based on chaos parameter (up to ±15% of range)
+        velocity.variation = chaos > 0.0f ? (maxVel - minVel) * chaos * 0.3f : 0.0f;
+        
+        // BD typically louder than other drums
+        velocity.boost = voice == 0 ? 10 : 0;
+        
+        gridsEngine.setVoiceVelocity(voice, velocity);
     }
-    
-    return normalVel;
 #else
     // Fallback to original fixed velocities
-    if (isBD)
-        return isAccent ? 127 : 100;
-    else if (voice == "sd")
-        return isAccent ? 127 : 90;
-    else
-        return isAccent ? 127 : 80;
+    const uint8_t normalVelocities[] = { 100, 90, 80 };
+    for (int voice = 0; voice < 3; ++voice)
+    {
+        GridsEngine::VoiceVelocity velocity;
+        velocity.normal = normalVelocities[voice];
+        velocity.accent = 127;
+        gridsEngine.setVoiceVelocity(voice, velocity);
+    }
 #endif
 }
 
@@ -639,6 +1094,18 @@ juce::AudioProcessorEditor* GridsAudioProcessor::createEditor()
 void GridsAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
     auto state = parameters.copyState();
+    state.setProperty("stateVersion", kStateVersion, nullptr);
+    
+    // Save MIDI learn assignments
+    auto learnTree = state.getOrCreateChildWithName("MidiLearn", nullptr);
+    midiLearn.saveToValueTree(learnTree, getParameters());
+    
+    // Save the groove template
+    auto grooveTree = state.getOrCreateChildWithName("Groove", nullptr);
+    {
+        const juce::ScopedLock lock(grooveStateLock);
+        editGroove.saveToValueTree(grooveTree, grooveName);
+    }
     
 #ifdef ENABLE_MODULATION_MATRIX
     // Save modulation matrix state
@@ -659,8 +1126,39 @@ void GridsAudioProcessor::setStateInformation (const void* data, int sizeInBytes
         if (xmlState->hasTagName (parameters.state.getType()))
         {
             auto newState = juce::ValueTree::fromXml (*xmlState);
+            
+            // Sessions saved before gate lengths existed held every note until the next step
+            if (!newState.getChildWithProperty("id", "gate_mode").isValid()) {
+                juce::ValueTree gateMode("PARAM");
+                gateMode.setProperty("id", "gate_mode", nullptr);
+                gateMode.setProperty("value", 1.0f, nullptr);
+                newState.appendChild(gateMode, nullptr);
+            }
+            
+            // Before version 2, swing above 0.5 pulled the odd 16ths early by up to
+            // 0.05 PPQ; it now delays them by up to 0.125 PPQ. Map old values onto
+            // the same timing
+            if (static_cast<int>(newState.getProperty("stateVersion", 1)) < 2) {
+                auto swing = newState.getChildWithProperty("id", "swing");
+                if (swing.isValid()) {
+                    const float oldSwing = swing.getProperty("value", 0.5f);
+                    swing.setProperty("value", juce::jlimit(0.0f, 1.0f, 0.5f - (oldSwing - 0.5f) * 0.4f), nullptr);
+                }
+            }
+            
             parameters.replaceState (newState);
             
+            // Restore MIDI learn assignments
+            midiLearn.loadFromValueTree(newState.getChildWithName("MidiLearn"), getParameters());
+            
+            // Restore the groove template
+            GrooveTemplate restoredGroove;
+            juce::String restoredName;
+            if (GrooveTemplate::loadFromValueTree(newState.getChildWithName("Groove"), restoredGroove, restoredName))
+                setGroove(restoredGroove, restoredName);
+            else
+                clearGroove();
+            
 #ifdef ENABLE_MODULATION_MATRIX
             // Restore modulation matrix state
             auto modTree = newState.getChildWithName("ModulationMatrix");
@@ -671,47 +1169,96 @@ void GridsAudioProcessor::setStateInformation (const void* data, int sizeInBytes
     }
 }
 
+juce::AudioPlayHead::PositionInfo GridsAudioProcessor::getClockPosition(ClockSource source)
+{
+    juce::AudioPlayHead::PositionInfo pos;
+    
+    if (source == ClockSource::Internal) {
+        const double bpm = *paramRefs.internalBpm;
+        internalClock.setRate((bpm / 60.0) / currentSampleRate);
+        
+        pos.setBpm(bpm);
+        pos.setPpqPosition(internalClock.getPpq());
+        pos.setIsPlaying(true);
+        internalClock.advance(blockSize);
+    } else {
+        // No tempo until the clock has locked, so nothing plays before then
+        const double ppqPerSample = midiClock.getPpqPerSample();
+        if (ppqPerSample > 0.0)
+            pos.setBpm(ppqPerSample * currentSampleRate * 60.0);
+        
+        pos.setPpqPosition(midiClock.getPpqAt(blockStartSample));
+        pos.setIsPlaying(midiClock.isRunning());
+    }
+    
+    return pos;
+}
+
+juce::String GridsAudioProcessor::loadGroove(const juce::File& file)
+{
+    GrooveTemplate newGroove;
+    juce::String name;
+    auto error = GrooveTemplate::loadFromFile(file, newGroove, name);
+    if (error.isEmpty())
+        setGroove(newGroove, name);
+    return error;
+}
+
+void GridsAudioProcessor::setGroove(const GrooveTemplate& newGroove, const juce::String& name)
+{
+    {
+        const juce::ScopedLock lock(grooveStateLock);
+        editGroove = newGroove;
+        grooveName = name;
+    }
+    
+    // Only the latest template matters, so a newer one simply replaces a pending one
+    const juce::SpinLock::ScopedLockType lock(pendingGrooveLock);
+    pendingGroove = newGroove;
+    hasPendingGroove = true;
+}
+
 #ifdef ENABLE_MODULATION_MATRIX
 // Get modulated parameter values for UI display
 float GridsAudioProcessor::getModulatedBDDensity()
 {
-    float baseValue = parameters.getRawParameterValue("density_1_bd")->load();
+    float baseValue = paramRefs.bdDensity->load();
     return modulationMatrix.applyModulation(ModulationMatrix::BD_DENSITY, baseValue);
 }
 
 float GridsAudioProcessor::getModulatedSDDensity()
 {
-    float baseValue = parameters.getRawParameterValue("density_2_sd")->load();
+    float baseValue = paramRefs.sdDensity->load();
     return modulationMatrix.applyModulation(ModulationMatrix::SD_DENSITY, baseValue);
 }
 
 float GridsAudioProcessor::getModulatedHHDensity()
 {
-    float baseValue = parameters.getRawParameterValue("density_3_hh")->load();
+    float baseValue = paramRefs.hhDensity->load();
     return modulationMatrix.applyModulation(ModulationMatrix::HH_DENSITY, baseValue);
 }
 
 float GridsAudioProcessor::getModulatedChaos()
 {
-    float baseValue = parameters.getRawParameterValue("chaos")->load();
+    float baseValue = paramRefs.chaos->load();
     return modulationMatrix.applyModulation(ModulationMatrix::CHAOS, baseValue);
 }
 
 float GridsAudioProcessor::getModulatedSwing()
 {
-    float baseValue = parameters.getRawParameterValue("swing")->load();
+    float baseValue = paramRefs.swing->load();
     return modulationMatrix.applyModulation(ModulationMatrix::SWING, baseValue);
 }
 
 float GridsAudioProcessor::getModulatedX()
 {
-    float baseValue = parameters.getRawParameterValue("x")->load();
+    float baseValue = paramRefs.x->load();
     return modulationMatrix.applyModulation(ModulationMatrix::PATTERN_X, baseValue);
 }
 
 float GridsAudioProcessor::getModulatedY()
 {
-    float baseValue = parameters.getRawParameterValue("y")->load();
+    float baseValue = paramRefs.y->load();
     return modulationMatrix.applyModulation(ModulationMatrix::PATTERN_Y, baseValue);
 }
 
@@ -725,49 +1272,39 @@ bool GridsAudioProcessor::isResetModulated()
 #ifdef ENABLE_VELOCITY_SYSTEM
 float GridsAudioProcessor::getModulatedBDVelocity()
 {
-    float baseValue = parameters.getRawParameterValue("velocity_1_bd")->load();
+    float baseValue = paramRefs.bdVelocity->load();
     return modulationMatrix.applyModulation(ModulationMatrix::BD_VELOCITY, baseValue);
 }
 
 float GridsAudioProcessor::getModulatedSDVelocity()
 {
-    float baseValue = parameters.getRawParameterValue("velocity_2_sd")->load();
+    float baseValue = paramRefs.sdVelocity->load();
     return modulationMatrix.applyModulation(ModulationMatrix::SD_VELOCITY, baseValue);
 }
 
 float GridsAudioProcessor::getModulatedHHVelocity()
 {
-    float baseValue = parameters.getRawParameterValue("velocity_3_hh")->load();
+    float baseValue = paramRefs.hhVelocity->load();
     return modulationMatrix.applyModulation(ModulationMatrix::HH_VELOCITY, baseValue);
 }
 #endif
 #endif
 
 // This creates new instances of the plugin
-void GridsAudioProcessor::executeReset()
+void GridsAudioProcessor::executeReset(int sampleOffset)
 {
-    DBG("executeReset() called");
     gridsEngine.reset();  // Always reset position
-    sampleCounter = 0;
     currentPatternStep = 0;  // Reset pattern step tracking
     
-    // Store the current PPQ position as offset for proper pattern restart
-    if (auto* playHead = getPlayHead()) {
-        auto posOptional = playHead->getPosition();
-        if (posOptional.hasValue()) {
-            auto pos = *posOptional;
-            if (pos.getPpqPosition().hasValue()) {
-                ppqOffsetAtReset = *pos.getPpqPosition();
-                hasResetOffset = true;
-                DBG("Stored PPQ offset at reset: " << ppqOffsetAtReset);
-            }
-        }
+    // Store the PPQ position of the reset sample as offset for proper pattern restart
+    if (blockHasPpq) {
+        ppqOffsetAtReset = blockPpq + sampleOffset * blockPpqPerSample;
+        hasResetOffset = true;
     }
     
     // Check reset mode
-    int resetMode = *parameters.getRawParameterValue("reset_mode");
+    int resetMode = *paramRefs.resetMode;
     bool isRetrigger = (resetMode == 1);
-    DBG("Reset mode: " << (isRetrigger ? "Retrigger" : "Transparent"));
     
     if (isRetrigger) {
         // Drill'n'bass mode - evaluate and fire triggers immediately
@@ -775,8 +1312,12 @@ void GridsAudioProcessor::executeReset()
     }
     
     // Notify UI of reset
-    notifyReset(isRetrigger);
-    DBG("Reset executed, pattern step: " << currentPatternStep);
+    if (telemetryActive.load(std::memory_order_relaxed)) {
+        TelemetryEvent resetEvent;
+        resetEvent.type = TelemetryEvent::Reset;
+        resetEvent.retrigger = isRetrigger;
+        telemetry.push(resetEvent);
+    }
 }
 
 bool GridsAudioProcessor::isQuantizePoint(const juce::AudioPlayHead::PositionInfo& posInfo, QuantizeValue quantize)
@@ -1,7 +1,16 @@
 #pragma once
 
 #include <juce_audio_processors/juce_audio_processors.h>
+#include <bitset>
 #include "Grids/GridsEngine.h"
+#include "Timing/StepScheduler.h"
+#include "Timing/PhaseAccumulator.h"
+#include "Timing/MidiClockSync.h"
+#include "Timing/GrooveTemplate.h"
+#include "Timing/NoteOffQueue.h"
+#include "Utils/TelemetryQueue.h"
+#include "Utils/MidiLearnMap.h"
+#include "Utils/ParameterNotifier.h"
 
 #ifdef ENABLE_MODULATION_MATRIX
 #include "Modulation/ModulationMatrix.h"
@@ -22,6 +31,13 @@ enum QuantizeValue {
     QUANTIZE_1_16T        // 1/16 triplet
 };
 
+// Where transport and tempo come from
+enum class ClockSource {
+    Host = 0,    // The host's play head
+    Internal,    // Always running at the Internal BPM parameter
+    MidiClock    // Incoming MIDI clock, Start/Stop/Continue and song position
+};
+
 class GridsAudioProcessor : public juce::AudioProcessor
 {
 public:
@@ -58,35 +74,98 @@ public:
     // Parameters
     juce::AudioProcessorValueTreeState parameters;
     
-    // Get the Grids engine for UI access
-    GridsEngine& getGridsEngine() { return gridsEngine; }
+    // Raw parameter values resolved once at construction, shared by the audio thread and UI timers
+    struct ParameterRefs
+    {
+        std::atomic<float>* x = nullptr;
+        std::atomic<float>* y = nullptr;
+        std::atomic<float>* chaos = nullptr;
+        std::atomic<float>* swing = nullptr;
+        std::atomic<float>* swingMode = nullptr;
+        std::atomic<float>* clockSource = nullptr;
+        std::atomic<float>* internalBpm = nullptr;
+        std::atomic<float>* seed = nullptr;
+        std::atomic<float>* midiThru = nullptr;
+        std::atomic<float>* liveMode = nullptr;
+        std::atomic<float>* midiChannel = nullptr;
+        std::atomic<float>* reset = nullptr;
+        std::atomic<float>* resetMode = nullptr;
+        std::atomic<float>* interpolation = nullptr;
+        std::atomic<float>* gateMode = nullptr;
+        std::atomic<float>* gateLength = nullptr;
+        std::atomic<float>* noteReset = nullptr;
+        std::atomic<float>* noteFill = nullptr;
+        std::atomic<float>* bdDensity = nullptr;
+        std::atomic<float>* sdDensity = nullptr;
+        std::atomic<float>* hhDensity = nullptr;
+#ifdef ENABLE_EUCLIDEAN_MODE
+        std::atomic<float>* euclideanMode = nullptr;
+        std::array<std::atomic<float>*, GridsEngine::kNumDrumVoices> euclideanLengths {};
+        std::array<std::atomic<float>*, GridsEngine::kNumDrumVoices> euclideanRotations {};
+        std::atomic<float>* euclideanAlgorithm = nullptr;
+        std::array<std::atomic<float>*, GridsEngine::kNumDrumVoices> euclideanAccentModes {};
+        std::array<std::atomic<float>*, GridsEngine::kNumDrumVoices> euclideanAccentValues {};
+        std::atomic<float>* hybridMode = nullptr;
+        std::array<std::atomic<float>*, GridsEngine::kNumDrumVoices> combineOps {};
+        std::array<std::atomic<float>*, GridsEngine::kNumDrumVoices> combineBlends {};
+#endif
+#ifdef ENABLE_VELOCITY_SYSTEM
+        std::atomic<float>* bdVelocity = nullptr;
+        std::atomic<float>* sdVelocity = nullptr;
+        std::atomic<float>* hhVelocity = nullptr;
+#endif
+        std::atomic<float>* bdNote = nullptr;
+        std::atomic<float>* sdNote = nullptr;
+        std::atomic<float>* hhNote = nullptr;
+    };
+    const ParameterRefs& getParameterRefs() const { return paramRefs; }
     
 #ifdef ENABLE_MODULATION_MATRIX
     // Get the modulation matrix for UI access
     ModulationMatrix& getModulationMatrix() { return modulationMatrix; }
 #endif
     
-    // Check if reset occurred (for UI feedback)
-    bool hasResetOccurred() { 
-        bool occurred = resetOccurred;
-        resetOccurred = false;
-        return occurred;
-    }
-    bool wasResetRetrigger() { return wasRetrigger; }
+    // Steps, resets and pattern changes for the UI (audio thread pushes, editor drains)
+    TelemetryQueue& getTelemetry() { return telemetry; }
     
-    // Notify reset occurred (for UI feedback)
-    void notifyReset(bool isRetrigger) { resetOccurred = true; wasRetrigger = isRetrigger; }
+    // An open editor turns telemetry on; without one nothing would drain the queue.
+    // Turning it on also republishes the current pattern
+    void setTelemetryActive(bool active)
+    {
+        if (active)
+            patternRefreshRequested = true;
+        telemetryActive = active;
+    }
     
     // Set/get reset quantization
     void setResetQuantize(QuantizeValue value) { resetQuantize = value; }
     QuantizeValue getResetQuantize() const { return resetQuantize; }
     
+    // MIDI learn - any parameter can follow a CC
+    MidiLearnMap& getMidiLearn() { return midiLearn; }
+    void startMidiLearn(const juce::String& parameterID) {
+        if (auto* parameter = parameters.getParameter(parameterID))
+            midiLearn.startLearning(parameter->getParameterIndex());
+    }
+    
     // MIDI learn for reset
-    void startMidiLearnForReset() { midiLearnActive = true; }
-    void stopMidiLearn() { midiLearnActive = false; }
-    bool isMidiLearning() const { return midiLearnActive; }
-    int getResetMidiCC() const { return resetMidiCC; }
-    void setResetMidiCC(int cc) { resetMidiCC = cc; }
+    void startMidiLearnForReset() { midiLearn.startLearning(resetParameterIndex); }
+    void stopMidiLearn() { midiLearn.stopLearning(); }
+    bool isMidiLearning() const { return midiLearn.isLearning(); }
+    int getResetMidiCC() const { return midiLearn.getControllerForParameter(resetParameterIndex); }
+    void setResetMidiCC(int cc) {
+        if (cc < 0) midiLearn.clearController(getResetMidiCC());
+        else midiLearn.assign(cc, resetParameterIndex);
+    }
+    
+    // Groove templates (message thread). loadGroove returns an error message, empty on success
+    juce::String loadGroove(const juce::File& file);
+    void clearGroove() { setGroove(GrooveTemplate(), {}); }
+    juce::String getGrooveName() const
+    {
+        const juce::ScopedLock lock(grooveStateLock);
+        return grooveName;
+    }
     
 #ifdef ENABLE_MODULATION_MATRIX
     // Get modulated parameter values for UI display
@@ -109,6 +188,10 @@ private:
     // Create parameter layout
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     
+    // Cached parameter pointers (see ParameterRefs)
+    ParameterRefs paramRefs;
+    int resetParameterIndex = -1;
+    
     // Grids pattern engine
     GridsEngine gridsEngine;
     
@@ -118,31 +201,127 @@ private:
 #endif
     
     // Timing
+    StepScheduler stepScheduler;
     double currentSampleRate = 44100.0;
-    int samplesPerClock = 0;
-    int sampleCounter = 0;
+    PhaseAccumulator freeRunClock;   // Position when the host has no moving PPQ
+    bool freeRunning = false;
+    
+    // Clock sources other than the host
+    PhaseAccumulator internalClock;
+    MidiClockSync midiClock;
+    ClockSource activeClockSource = ClockSource::Host;
     double lastPpqPosition = 0.0;
     bool isPlaying = false;
     
     // Reset handling
     float lastResetValue = 0.0f;
+    float ccResetValue = 0.0f;          // Level of a learned reset CC
+    
+    // Incoming MIDI that acts on the sequencer, applied at its exact sample offset
+    struct ControlEvent {
+        enum Type : uint8_t { ResetLevel, NoteReset, Parameter, FillOn, FillOff };
+        int sample = 0;
+        Type type = ResetLevel;
+        float value = 0.0f;
+        int index = 0;  // Parameter: its index in getParameters(). Fills: the note
+    };
+    static constexpr int kMaxControlEvents = 64;
+    std::array<ControlEvent, kMaxControlEvents> controlEvents;
+    int numControlEvents = 0;
+    
+    bool resetReleasePosted = false;    // Return-to-zero for the reset button already queued
     bool shouldRetrigger = false;
-    bool resetOccurred = false;
-    bool wasRetrigger = false;
     bool resetArmed = false;
     QuantizeValue resetQuantize = QUANTIZE_OFF;
     double quantizePhase = 0.0;
     
+    // Saved with the state so older sessions can be migrated (2: swing delays, +-0.125 PPQ)
+    static constexpr int kStateVersion = 2;
+    
+    // Swing for the step scheduler, with modulation applied (updateEngineParameters)
+    float blockSwing = 0.5f;
+    
+    // Transport position of the current block
+    bool blockHasPpq = false;
+    double blockPpq = 0.0;
+    double blockPpqPerSample = 0.0;
+    
+    // X/Y and densities, interpolated from the previous block's values to this
+    // block's and applied to the engine at each step
+    enum RampedParameter { RampX, RampY, RampBDDensity, RampSDDensity, RampHHDensity, kNumRampedParameters };
+    using RampValues = std::array<float, kNumRampedParameters>;
+    RampValues rampStart {};
+    RampValues rampEnd {};
+    bool rampPrimed = false;
+    
+    // Fills: while a note is held (with Note Fill on) every density is raised
+    static constexpr float kFillDensityBoost = 0.35f;
+    std::bitset<128> fillNotes;
+    
+    // Groove template: the copy for state and the UI, the latest one waiting for
+    // the audio thread, and the one playing. The audio thread only try-locks, so
+    // loading never blocks playback. Hosts may restore state off the message
+    // thread, so the state copy has a lock of its own
+    juce::CriticalSection grooveStateLock;
+    GrooveTemplate editGroove;
+    juce::String grooveName;
+    juce::SpinLock pendingGrooveLock;
+    GrooveTemplate pendingGroove;
+    bool hasPendingGroove = false;
+    GrooveTemplate groove;
+    void setGroove(const GrooveTemplate& newGroove, const juce::String& name);
+    
     // MIDI note numbers
-    int bdNote = 36;  // C1
-    int sdNote = 38;  // D1
-    int hhNote = 42;  // F#1
+    std::array<int, GridsEngine::kNumDrumVoices> voiceNotes { 36, 38, 42 };  // C1, D1, F#1
+    
+    // Upcoming hits for the current bar, rendered once per bar (or when the pattern changes)
+    static constexpr int kLookaheadSteps = 16;
+    std::array<GridsEngine::PatternEvent, kLookaheadSteps * GridsEngine::kMaxVoices> lookaheadEvents;
+    int numLookaheadEvents = 0;
+    int64_t lookaheadStart = 0;
+    uint32_t lookaheadVersion = 0;
+    bool lookaheadValid = false;
+    bool lookaheadPublished = false;
+    uint32_t soundingTriggers = 0;  // Voices held until the next step (bit v = voice v)
+    
+    // UI telemetry
+    TelemetryQueue telemetry;
+    std::atomic<bool> telemetryActive { false };
+    std::atomic<bool> patternRefreshRequested { true };
+    uint32_t publishedPatternVersion = 0;
+    int64_t publishedPatternWindow = 0;
+    
+    // MIDI output staging, reserved in prepareToPlay. Its storage trades places
+    // with the host's buffer every block (see processBlock)
+    static constexpr int kMidiEventBytes = 16;               // Timestamp, size and 3 data bytes, rounded up
+    static constexpr int kMaxGeneratedEventsPerBlock = 512;  // Note ons/offs from the pattern
+    juce::MidiBuffer stagingMidi;
+    int midiBufferBytes = 0;
+    
+    // Fixed-length gates: note-offs scheduled at absolute sample times
+    NoteOffQueue<64> noteOffQueue;
+    std::array<uint32_t, GridsEngine::kNumDrumVoices> voiceNoteIds {};  // Latest note-on per voice
+    uint32_t gatedVoices = 0;       // Voices waiting for a queued note-off (bit v = voice v)
+    int64_t blockStartSample = 0;   // Absolute sample position of the current block
+    int blockSize = 0;
+    int64_t gateSamples = 0;        // Gate length for this block, 0 = sustained until the next step
     int midiChannel = 1;
     
     // MIDI learn
-    bool midiLearnActive = false;
-    int resetMidiCC = -1;  // -1 means no CC assigned
-    float lastCCValue = 0.0f;
+    MidiLearnMap midiLearn;
+    
+    // A learned CC writes the parameter's raw value, which the audio thread reads
+    // directly, and posts the change to the host (indexed like getParameters())
+    struct LearnTarget
+    {
+        std::atomic<float>* value = nullptr;
+        juce::NormalisableRange<float> range;
+    };
+    std::vector<LearnTarget> learnTargets;
+    void applyLearnedController(int parameterIndex, float normalisedValue);
+    
+    // Host-facing parameter changes made by the audio thread go out from the message thread
+    ParameterNotifier parameterNotifier { *this };
     
     // Count-in and sync tracking
     bool wasInCountIn = false;
@@ -150,21 +329,69 @@ private:
     double ppqOffsetAtReset = 0.0;  // PPQ position when reset was triggered
     bool hasResetOffset = false;  // Whether we have an active reset offset
     
-    // Calculate samples per clock based on tempo
-    void updateTiming(const juce::AudioPlayHead::PositionInfo& posInfo);
+    // Transport and tempo for this block from the internal or MIDI clock
+    juce::AudioPlayHead::PositionInfo getClockPosition(ClockSource source);
     
     // Check if we're at a quantize point
     bool isQuantizePoint(const juce::AudioPlayHead::PositionInfo& posInfo, QuantizeValue quantize);
     
-    // Execute the reset
-    void executeReset();
+    // Execute the reset at a sample offset in the current block
+    void executeReset(int sampleOffset);
+    
+    // Reset now, or arm it for the next quantize point
+    void triggerReset(int sampleOffset);
+    
+    // Trigger a reset on a rising edge of the combined reset level
+    void detectResetEdge(int sampleOffset);
+    
+    void addControlEvent(const ControlEvent& event);
+    void applyControlEvent(const ControlEvent& event);
+    
+    // Apply every control event in the block at once, for blocks that generate nothing
+    // (stopped, count-in, no position) so resets and retriggers aren't lost
+    void applyControlEventsWithoutPlaying();
+    
+    // Play the steps that start in [startSample, endSample) of the block
+    void generateSteps(juce::MidiBuffer& midiMessages, int startSample, int endSample, bool justExitedCountIn);
+    
+    // Fire step 0 immediately after a retrigger reset
+    void fireRetrigger(juce::MidiBuffer& midiMessages, int sampleOffset);
     
     // Generate MIDI note
     void addMidiNote(juce::MidiBuffer& midiMessages, int sampleOffset, 
                      int noteNumber, bool noteOn, int velocity);
+    static void addNoteMessage(juce::MidiBuffer& midiMessages, int sampleOffset,
+                               int channel, int noteNumber, bool noteOn, int velocity);
+    
+    // Apply parameters (and modulation) to the engine and per-block settings. At
+    // the block start X/Y and densities start a new ramp; called again at a
+    // sample offset (after a learned CC), the ones that changed jump there
+    void updateEngineParameters(int midBlockSample = -1);
+    
+    // Apply the ramped X/Y and densities at a sample offset in the current block
+    void applyRampedParameters(int sampleOffset);
+    
+    // Push the pattern masks to the UI if they changed
+    void publishPattern();
+    
+    // Render the bar containing a step into the lookahead buffer
+    void renderLookahead(int64_t step);
+    
+    // Push the rendered lookahead to the UI once per render
+    void publishLookahead();
+    
+    // Note offs for the voices sounding from the previous step, then note ons
+    // for this step's events from the lookahead buffer
+    void playStep(juce::MidiBuffer& midiMessages, int sampleOffset, int64_t step);
+    
+    // Send the queued note-offs that fall before endSample (absolute)
+    void releaseDueNotes(juce::MidiBuffer& midiMessages, int64_t endSample);
+    
+    // Precompute each voice's velocity profile from the velocity range settings (once per block)
+    void updateVelocityTable();
     
-    // Calculate velocity based on accent and velocity range settings
-    int calculateVelocity(bool isBD, bool isAccent, const juce::String& voice);
+    // Velocity for a voice index (0 = BD, 1 = SD, 2 = HH) at the current step
+    int calculateVelocity(int voice, bool isAccent) const { return gridsEngine.getVelocity(voice, isAccent); }
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (GridsAudioProcessor)
 };
\ No newline at end of file
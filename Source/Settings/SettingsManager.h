@@ -213,7 +213,7 @@ private:
         settings->setProperty(Keys::liveModeDefault, false);
         
         // Advanced Defaults (global)
-        settings->setProperty(Keys::defaultGateMode, false);
+        settings->setProperty(Keys::defaultGateMode, true);  // Hold until the next step, as before gate lengths
         settings->setProperty(Keys::euclideanBDLength, 16);
         settings->setProperty(Keys::euclideanSDLength, 12);
         settings->setProperty(Keys::euclideanHHLength, 8);
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "StepScheduler.h"
+
+/**
+ * GrooveTemplate - Per-step timing and velocity map compiled to fixed arrays
+ *
+ * Templates are parsed on the message thread and expanded to one entry per
+ * step of the pattern. The audio thread only copies the arrays and looks
+ * steps up. Sources:
+ *
+ * JSON (arrays shorter than 32 entries repeat):
+ *   { "name": "Pushed", "timing": [0, 0.24, 0, 0.24], "velocity": [1, 0.7] }
+ * timing is in fractions of a 16th (positive = late), velocity is a scale.
+ * MPC-style swing is given as the MPC's percentage instead of timing - where
+ * the second 16th of each 8th falls, 50 (straight) to 75:
+ *   { "name": "MPC 62%", "mpcSwing": 62, "velocity": [1, 0.7] }
+ *
+ * MIDI files (.mid) and Ableton Live grooves (.agr, plain or gzipped XML):
+ * the note-ons of the first two bars. Each 16th takes the timing and velocity
+ * of the onset nearest to it; Live's own Timing/Velocity amounts are not read,
+ * the Swing control scales the groove instead.
+ */
+struct GrooveTemplate
+{
+    static constexpr int kSteps = StepScheduler::kTableSteps;
+    static constexpr double kMaxTiming = 0.49;  // Keeps every step on its own side of its neighbours
+
+    std::array<double, kSteps> timing {};   // Offset of each step, in steps
+    std::array<float, kSteps> velocity {};  // Velocity scale of each step
+
+    GrooveTemplate() { velocity.fill(1.0f); }
+
+    float getVelocityScale(int64_t step) const { return velocity[static_cast<size_t>(step & (kSteps - 1))]; }
+
+    // File types loadFromFile understands, as a FileChooser pattern
+    static constexpr const char* kFilePatterns = "*.json;*.mid;*.midi;*.agr";
+
+    // Parses a template file by extension (.json, .mid/.midi, .agr). Returns an error message on failure
+    static juce::String loadFromFile(const juce::File& file, GrooveTemplate& result, juce::String& name)
+    {
+        name = file.getFileNameWithoutExtension();
+
+        if (file.hasFileExtension("json"))
+            return fromJson(file.loadFileAsString(), result, name);
+        if (file.hasFileExtension("mid;midi"))
+            return fromMidiFile(file, result);
+        if (file.hasFileExtension("agr"))
+            return fromAbletonGroove(file, result);
+
+        return "Unsupported groove file: " + file.getFileName();
+    }
+
+    static juce::String fromJson(const juce::String& text, GrooveTemplate& result, juce::String& name)
+    {
+        auto json = juce::JSON::parse(text);
+        if (!json.isObject())
+            return "Groove JSON must be an object";
+
+        if (json.hasProperty("name"))
+            name = json["name"].toString();
+
+        GrooveTemplate groove;
+        if (json.hasProperty("mpcSwing")) {
+            const double percent = json["mpcSwing"];
+            if (percent < 50.0 || percent > 75.0)
+                return "\"mpcSwing\" must be between 50 and 75";
+
+            // The second 16th of each 8th sits at percent% of the 8th
+            for (int step = 1; step < kSteps; step += 2)
+                groove.timing[static_cast<size_t>(step)] = clampTiming(percent / 50.0 - 1.0);
+        } else if (auto* timing = json["timing"].getArray()) {
+            if (timing->isEmpty() || timing->size() > kSteps)
+                return "\"timing\" needs 1 to " + juce::String(kSteps) + " entries";
+
+            for (int step = 0; step < kSteps; ++step)
+                groove.timing[static_cast<size_t>(step)] = clampTiming((*timing)[step % timing->size()]);
+        }
+
+        if (auto* velocity = json["velocity"].getArray()) {
+            if (velocity->isEmpty() || velocity->size() > kSteps)
+                return "\"velocity\" needs 1 to " + juce::String(kSteps) + " entries";
+
+            for (int step = 0; step < kSteps; ++step)
+                groove.velocity[static_cast<size_t>(step)] = clampVelocity((*velocity)[step % velocity->size()]);
+        }
+
+        result = groove;
+        return {};
+    }
+
+    // Extracts timing and velocity from the note-ons of the first two bars
+    static juce::String fromMidiFile(const juce::File& file, GrooveTemplate& result)
+    {
+        juce::FileInputStream stream(file);
+        juce::MidiFile midiFile;
+        if (!stream.openedOk() || !midiFile.readFrom(stream))
+            return "Couldn't read MIDI file: " + file.getFileName();
+
+        const int ticksPerQuarter = midiFile.getTimeFormat();
+        if (ticksPerQuarter <= 0)
+            return "SMPTE-timed MIDI files aren't supported";
+
+        std::vector<Onset> onsets;
+        for (int track = 0; track < midiFile.getNumTracks(); ++track) {
+            for (const auto* event : *midiFile.getTrack(track)) {
+                const auto& message = event->message;
+                if (message.isNoteOn())
+                    onsets.push_back({ message.getTimeStamp() / ticksPerQuarter, message.getVelocity() });
+            }
+        }
+
+        return fromOnsets(onsets, result, file);
+    }
+
+    // Extracts timing and velocity from the clip of an Ableton Live groove (.agr)
+    static juce::String fromAbletonGroove(const juce::File& file, GrooveTemplate& result)
+    {
+        // Live writes its documents gzipped; older or hand-edited grooves may be plain XML
+        juce::MemoryBlock data;
+        if (!file.loadFileAsData(data))
+            return "Couldn't read groove file: " + file.getFileName();
+
+        juce::String text;
+        if (data.getSize() > 2 && static_cast<uint8_t>(data[0]) == 0x1f && static_cast<uint8_t>(data[1]) == 0x8b) {
+            juce::MemoryInputStream compressed(data, false);
+            juce::GZIPDecompressorInputStream decompressed(&compressed, false, juce::GZIPDecompressorInputStream::gzipFormat);
+            text = decompressed.readEntireStreamAsString();
+        } else {
+            text = data.toString();
+        }
+
+        auto xml = juce::parseXML(text);
+        if (xml == nullptr || !xml->hasTagName("Ableton"))
+            return "Not an Ableton groove: " + file.getFileName();
+
+        // Note times are in beats from the clip start
+        std::vector<Onset> onsets;
+        std::function<void(const juce::XmlElement&)> collect = [&](const juce::XmlElement& element) {
+            for (auto* child : element.getChildIterator()) {
+                if (child->hasTagName("MidiNoteEvent"))
+                    onsets.push_back({ child->getDoubleAttribute("Time"), juce::roundToInt(child->getDoubleAttribute("Velocity")) });
+                else
+                    collect(*child);
+            }
+        };
+        collect(*xml);
+
+        return fromOnsets(onsets, result, file);
+    }
+
+    void saveToValueTree(juce::ValueTree& tree, const juce::String& name) const
+    {
+        juce::StringArray timingValues, velocityValues;
+        for (int step = 0; step < kSteps; ++step) {
+            timingValues.add(juce::String(timing[static_cast<size_t>(step)], 4));
+            velocityValues.add(juce::String(velocity[static_cast<size_t>(step)], 4));
+        }
+
+        tree.setProperty("name", name, nullptr);
+        tree.setProperty("timing", timingValues.joinIntoString(" "), nullptr);
+        tree.setProperty("velocity", velocityValues.joinIntoString(" "), nullptr);
+    }
+
+    static bool loadFromValueTree(const juce::ValueTree& tree, GrooveTemplate& result, juce::String& name)
+    {
+        auto timingValues = juce::StringArray::fromTokens(tree["timing"].toString(), false);
+        auto velocityValues = juce::StringArray::fromTokens(tree["velocity"].toString(), false);
+        if (timingValues.size() != kSteps || velocityValues.size() != kSteps)
+            return false;
+
+        for (int step = 0; step < kSteps; ++step) {
+            result.timing[static_cast<size_t>(step)] = clampTiming(timingValues[step].getDoubleValue());
+            result.velocity[static_cast<size_t>(step)] = clampVelocity(velocityValues[step].getFloatValue());
+        }
+
+        name = tree["name"].toString();
+        return true;
+    }
+
+private:
+    struct Onset
+    {
+        double beats = 0.0;  // Position in quarter notes
+        int velocity = 0;
+    };
+
+    // Each 16th of the first two bars takes the onset nearest to it (in any
+    // track or key), so a flam or a second voice doesn't displace the real hit
+    static juce::String fromOnsets(const std::vector<Onset>& onsets, GrooveTemplate& result, const juce::File& file)
+    {
+        std::array<double, kSteps> distances;
+        distances.fill(std::numeric_limits<double>::max());
+        std::array<int, kSteps> velocities {};
+        GrooveTemplate groove;
+
+        for (const auto& onset : onsets) {
+            const double position = onset.beats / StepScheduler::kPpqPerStep;
+            const int step = juce::roundToInt(position);
+            const double distance = std::abs(position - step);
+            if (step < 0 || step >= kSteps || onset.velocity <= 0 || distance >= distances[static_cast<size_t>(step)])
+                continue;
+
+            distances[static_cast<size_t>(step)] = distance;
+            groove.timing[static_cast<size_t>(step)] = juce::jlimit(-kMaxTiming, kMaxTiming, position - step);
+            velocities[static_cast<size_t>(step)] = onset.velocity;
+        }
+
+        const int loudest = *std::max_element(velocities.begin(), velocities.end());
+        if (loudest == 0)
+            return "No notes in the first two bars of " + file.getFileName();
+
+        // Velocities are relative to the loudest hit; empty steps stay neutral
+        for (int step = 0; step < kSteps; ++step) {
+            if (velocities[static_cast<size_t>(step)] > 0)
+                groove.velocity[static_cast<size_t>(step)] = static_cast<float>(velocities[static_cast<size_t>(step)]) / loudest;
+        }
+
+        result = groove;
+        return {};
+    }
+
+    static double clampTiming(const juce::var& value) { return juce::jlimit(-kMaxTiming, kMaxTiming, static_cast<double>(value)); }
+    static float clampVelocity(const juce::var& value) { return juce::jlimit(0.0f, 2.0f, static_cast<float>(value)); }
+};
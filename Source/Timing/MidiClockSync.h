@@ -0,0 +1,158 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * MidiClockSync - Transport and tempo from incoming MIDI clock
+ *
+ * Parses Clock (0xF8, 24 per quarter note), Start, Continue, Stop and Song
+ * Position Pointer at absolute sample times. Clock jitter is smoothed by a
+ * second-order phase-locked loop: every tick compares the position it
+ * implies with the loop's prediction, nudging the phase and the tempo by a
+ * fraction of the error. Between ticks the position is extrapolated from
+ * the locked tempo, so steps land between clock pulses on their own sample.
+ *
+ * Everything is plain arithmetic on fixed state, safe for the audio thread.
+ */
+class MidiClockSync
+{
+public:
+    static constexpr double kPpqPerTick = 1.0 / 24.0;
+
+    void reset()
+    {
+        running_ = false;
+        locked_ = false;
+        awaitingFirstTick_ = false;
+        basePpq_ = 0.0;
+        ticks_ = 0;
+        lastTickTime_ = -1;
+        lastPpq_ = 0.0;
+    }
+
+    // Feeds one MIDI message. Anything other than clock, transport and SPP is ignored
+    void handleMessage(const uint8_t* data, int numBytes, int64_t sampleTime)
+    {
+        if (numBytes < 1)
+            return;
+
+        switch (data[0])
+        {
+            case 0xf8: handleTick(sampleTime); break;
+            case 0xfa: startFrom(0.0); break;
+            case 0xfb: startFrom(getTickPpq()); break;
+            case 0xfc:
+                // Hold the position where the last tick left it
+                basePpq_ = getTickPpq();
+                ticks_ = 0;
+                running_ = false;
+                break;
+            case 0xf2:
+                // Position in MIDI beats (16ths); only meaningful while stopped
+                if (numBytes >= 3 && !running_)
+                {
+                    basePpq_ = static_cast<double>((data[2] << 7) | data[1]) * 0.25;
+                    ticks_ = 0;
+                    lastPpq_ = basePpq_;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    bool isRunning() const { return running_ && locked_; }
+    bool hasTempo() const { return locked_; }
+
+    double getPpqPerSample() const { return locked_ ? rate_ : 0.0; }
+
+    // Position at a sample time. While running it never moves backwards and never
+    // runs more than a tick past the last clock received, so a phase correction or
+    // a stalled clock can't replay or skip steps
+    double getPpqAt(int64_t sampleTime)
+    {
+        if (!isRunning() || awaitingFirstTick_)
+            return lastPpq_ = std::max(lastPpq_, getTickPpq());
+
+        const double predicted = phasePpq_ + static_cast<double>(sampleTime - phaseTime_) * rate_;
+        lastPpq_ = std::max(lastPpq_, std::min(predicted, getTickPpq() + kPpqPerTick));
+        return lastPpq_;
+    }
+
+private:
+    static constexpr double kPhaseGain = 0.1;        // Share of the phase error corrected per tick
+    static constexpr double kFrequencyGain = 0.005;  // Share of the phase error fed into the tempo
+    static constexpr double kTempoSmoothing = 0.1;   // Interval averaging before lock and while stopped
+
+    double getTickPpq() const { return basePpq_ + static_cast<double>(ticks_) * kPpqPerTick; }
+
+    void startFrom(double ppq)
+    {
+        basePpq_ = ppq;
+        ticks_ = 0;
+        lastPpq_ = ppq;
+        running_ = true;
+        awaitingFirstTick_ = true;  // The next tick is the position itself
+    }
+
+    void handleTick(int64_t sampleTime)
+    {
+        const int64_t interval = lastTickTime_ >= 0 ? sampleTime - lastTickTime_ : 0;
+        lastTickTime_ = sampleTime;
+
+        if (running_)
+        {
+            if (awaitingFirstTick_)
+                awaitingFirstTick_ = false;
+            else
+                ++ticks_;
+        }
+
+        if (interval <= 0)
+            return;
+
+        const double measuredRate = kPpqPerTick / static_cast<double>(interval);
+        const double tickPpq = getTickPpq();
+
+        if (!locked_ || !running_)
+        {
+            // Average intervals until the loop takes over
+            rate_ = locked_ ? rate_ + kTempoSmoothing * (measuredRate - rate_) : measuredRate;
+            locked_ = true;
+            phasePpq_ = tickPpq;
+            phaseTime_ = sampleTime;
+            return;
+        }
+
+        const double predicted = phasePpq_ + static_cast<double>(sampleTime - phaseTime_) * rate_;
+        const double error = tickPpq - predicted;
+
+        if (std::abs(error) > 4.0 * kPpqPerTick)
+        {
+            // Lost lock (tempo jump, dropped clocks): start over from this tick
+            phasePpq_ = tickPpq;
+            rate_ = measuredRate;
+        }
+        else
+        {
+            phasePpq_ = predicted + kPhaseGain * error;
+            rate_ = std::max(rate_ + kFrequencyGain * error / static_cast<double>(interval), 0.1 * measuredRate);
+        }
+        phaseTime_ = sampleTime;
+    }
+
+    bool running_ = false;
+    bool locked_ = false;
+    bool awaitingFirstTick_ = false;
+
+    double basePpq_ = 0.0;      // Position of the Start/Continue/SPP point
+    int64_t ticks_ = 0;         // Clocks since then
+    int64_t lastTickTime_ = -1;
+
+    double rate_ = 0.0;         // Locked tempo in PPQ per sample
+    double phasePpq_ = 0.0;     // Loop position estimate at phaseTime_
+    int64_t phaseTime_ = 0;
+    double lastPpq_ = 0.0;      // Last position handed out
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+
+/**
+ * NoteOffQueue - Pending note-offs ordered by absolute sample time
+ *
+ * A fixed-capacity binary min-heap, so scheduling and releasing notes never
+ * allocates on the audio thread. Entries keep their absolute sample time,
+ * which lets a note-off scheduled in one block fire at the exact sample of a
+ * later block.
+ */
+template <size_t Capacity>
+class NoteOffQueue
+{
+public:
+    struct Entry
+    {
+        int64_t sampleTime = 0;  // Absolute sample at which the note ends
+        uint32_t id = 0;         // Caller tag, e.g. to skip notes that were already released
+        uint8_t voice = 0;
+        uint8_t channel = 1;
+        uint8_t note = 0;
+    };
+
+    // Returns false when the queue is full; the caller should release the note itself
+    bool push(const Entry& entry)
+    {
+        if (size_ >= Capacity)
+        {
+            ++overflows_;
+            return false;
+        }
+
+        entries_[size_++] = entry;
+        std::push_heap(entries_.begin(), entries_.begin() + size_, Later{});
+        return true;
+    }
+
+    // Calls onNoteOff(entry) for every entry due before endSample, earliest first
+    template <typename Callback>
+    void popDue(int64_t endSample, Callback&& onNoteOff)
+    {
+        while (size_ > 0 && entries_[0].sampleTime < endSample)
+        {
+            std::pop_heap(entries_.begin(), entries_.begin() + size_, Later{});
+            --size_;
+            onNoteOff(entries_[size_]);
+        }
+    }
+
+    // Calls onNoteOff(entry) for every pending entry, earliest first
+    template <typename Callback>
+    void popAll(Callback&& onNoteOff) { popDue(std::numeric_limits<int64_t>::max(), onNoteOff); }
+
+    void clear() { size_ = 0; }
+    bool isEmpty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+
+    // Pushes refused because the queue was full, since construction
+    size_t overflowCount() const { return overflows_; }
+
+private:
+    // Heap comparator - the earliest sample time sits on top
+    struct Later
+    {
+        bool operator()(const Entry& a, const Entry& b) const { return a.sampleTime > b.sampleTime; }
+    };
+
+    std::array<Entry, Capacity> entries_ {};
+    size_t size_ = 0;
+    size_t overflows_ = 0;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * PhaseAccumulator - Drift-free musical position for free-running clocks
+ *
+ * Stands in for the host's PPQ position when there isn't a moving one. The
+ * position is an anchor plus a whole-sample count times the exact PPQ per
+ * sample, so the fractional part of a step carries over between blocks and
+ * rounding never accumulates: an hour-long set lands on the same sample as
+ * the ideal grid. A tempo change re-anchors at the current position.
+ */
+class PhaseAccumulator
+{
+public:
+    // Restart at a PPQ position (keeps the tempo)
+    void reset(double ppq = 0.0)
+    {
+        anchorPpq_ = ppq;
+        samples_ = 0;
+    }
+
+    // Tempo in PPQ per sample
+    void setRate(double ppqPerSample)
+    {
+        if (ppqPerSample != rate_)
+        {
+            anchorPpq_ = getPpq();
+            samples_ = 0;
+            rate_ = ppqPerSample;
+        }
+    }
+    double getRate() const { return rate_; }
+
+    // Position at the start of the current block
+    double getPpq() const { return anchorPpq_ + static_cast<double>(samples_) * rate_; }
+
+    // Move on to the next block
+    void advance(int numSamples) { samples_ += numSamples; }
+
+private:
+    double anchorPpq_ = 0.0;
+    double rate_ = 0.0;
+    int64_t samples_ = 0;
+};
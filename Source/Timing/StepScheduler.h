@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * StepScheduler - Locates 16th-note step boundaries analytically
+ *
+ * Instead of converting every sample to PPQ and testing which step it falls
+ * in, the scheduler computes where each step starts (origin, 16th grid and
+ * swing) and jumps straight to the sample offsets of the boundaries inside a
+ * block. Per-block cost is proportional to the number of steps, not samples.
+ *
+ * Swing is a table of per-step PPQ offsets over one 32-step pattern, rebuilt
+ * only when the swing settings change, so a boundary is a single lookup.
+ */
+class StepScheduler
+{
+public:
+    static constexpr double kPpqPerStep = 0.25;  // One 16th note
+    static constexpr int kTableSteps = 32;       // Offsets repeat every pattern
+
+    enum class SwingMode
+    {
+        Sixteenth,  // Odd 16ths move, up to 75% of the 8th
+        Eighth,     // Odd 8ths move, up to 75% of the beat; the 16ths between follow
+        Triplet,    // Odd 16ths move, up to the 16th-triplet position at full swing
+        Groove      // Per-step offsets from a groove template, scaled by swing (0.5 = as recorded)
+    };
+
+    // PPQ position of step 0 (the reset point, or 0 for the song start)
+    void setOrigin(double originPpq) { origin_ = originPpq; }
+    double getOrigin() const { return origin_; }
+
+    // Swing (0-1, 0.5 = straight). Above 0.5 the swung steps are late, below
+    // they are early. The offset table is only rebuilt when something changed
+    void setSwing(float swing, SwingMode mode = SwingMode::Sixteenth)
+    {
+        if (swing == swing_ && mode == mode_)
+            return;
+
+        swing_ = swing;
+        mode_ = mode;
+        rebuildOffsets();
+    }
+
+    // Groove template offsets in steps, one per table entry (within +-0.5 of a step)
+    void setGrooveTiming(const std::array<double, kTableSteps>& stepOffsets)
+    {
+        grooveTiming_ = stepOffsets;
+        if (mode_ == SwingMode::Groove)
+            rebuildOffsets();
+    }
+
+    // PPQ position at which a step starts
+    double getStepStartPpq(int64_t step) const
+    {
+        return origin_ + static_cast<double>(step) * kPpqPerStep + offsets_[static_cast<size_t>(step & (kTableSteps - 1))];
+    }
+
+    // The step that is sounding at a PPQ position
+    int64_t getStepAtPpq(double ppq) const
+    {
+        auto step = static_cast<int64_t>(std::floor((ppq - origin_) / kPpqPerStep));
+
+        // Offsets are at most one step and keep boundaries in order, so this settles in a move or two
+        while (ppq >= getStepStartPpq(step + 1))
+            ++step;
+        while (ppq < getStepStartPpq(step))
+            --step;
+        return step;
+    }
+
+    /**
+     * Calls onStep(sampleOffset, step) for every step that starts inside the
+     * block. The step already sounding at the block start is reported at
+     * sample 0 when includeCurrent is set. Returns the step sounding at the
+     * end of the block.
+     */
+    template <typename Callback>
+    int64_t processBlock(double blockStartPpq, double ppqPerSample, int numSamples,
+                         bool includeCurrent, Callback&& onStep) const
+    {
+        int64_t step = getStepAtPpq(blockStartPpq);
+        if (includeCurrent)
+            onStep(0, step);
+
+        if (ppqPerSample <= 0.0)
+            return step;
+
+        for (;;)
+        {
+            // First sample whose PPQ position reaches the next step. The tolerance keeps a
+            // boundary that falls exactly on a sample from slipping to the next one on rounding
+            double sampleOffset = std::ceil((getStepStartPpq(step + 1) - blockStartPpq) / ppqPerSample - 1.0e-6);
+            if (sampleOffset >= numSamples)
+                break;
+
+            ++step;
+            onStep(static_cast<int>(std::fmax(sampleOffset, 0.0)), step);
+        }
+
+        return step;
+    }
+
+private:
+    void rebuildOffsets()
+    {
+        // -1 (full rush) to 1 (full swing)
+        const double amount = (static_cast<double>(swing_) - 0.5) * 2.0;
+
+        for (int step = 0; step < kTableSteps; ++step)
+        {
+            double offset = 0.0;
+            switch (mode_)
+            {
+                case SwingMode::Sixteenth:
+                    offset = (step & 1) ? amount * kPpqPerStep * 0.5 : 0.0;
+                    break;
+                case SwingMode::Triplet:
+                    offset = (step & 1) ? amount * kPpqPerStep / 3.0 : 0.0;
+                    break;
+                case SwingMode::Eighth:
+                {
+                    // The off-beat 8th moves by d; the 16ths either side sit halfway into their halves
+                    const double d = amount * kPpqPerStep;
+                    const int position = step & 3;
+                    offset = position == 2 ? d : (position == 0 ? 0.0 : d * 0.5);
+                    break;
+                }
+                case SwingMode::Groove:
+                {
+                    // Under half a step either way, so boundaries stay in order
+                    const double scaled = grooveTiming_[static_cast<size_t>(step)] * swing_ * 2.0;
+                    offset = std::fmax(-0.49, std::fmin(0.49, scaled)) * kPpqPerStep;
+                    break;
+                }
+            }
+            offsets_[static_cast<size_t>(step)] = offset;
+        }
+    }
+
+    double origin_ = 0.0;
+    float swing_ = 0.5f;
+    SwingMode mode_ = SwingMode::Sixteenth;
+    std::array<double, kTableSteps> grooveTiming_ {};
+    std::array<double, kTableSteps> offsets_ {};
+};
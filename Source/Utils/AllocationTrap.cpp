@@ -0,0 +1,87 @@
+#include "AllocationTrap.h"
+
+#if GRIDDY_ALLOCATION_TRAP
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    void checkTrap()
+    {
+        if (ScopedAllocationTrap::isArmed())
+        {
+            // Something allocated inside processBlock. Lift the trap while
+            // asserting, since logging the assertion allocates too
+            ScopedAllocationAllowed allowed;
+            ++ScopedAllocationTrap::caughtAllocations();
+            jassertfalse;
+        }
+    }
+
+    void* allocate (std::size_t size)
+    {
+        checkTrap();
+
+        if (auto* ptr = std::malloc (size > 0 ? size : 1))
+            return ptr;
+
+        throw std::bad_alloc();
+    }
+
+    // Over-aligned types (alignas above the default new alignment) come through here
+    void* allocateAligned (std::size_t size, std::align_val_t alignment)
+    {
+        checkTrap();
+
+        auto align = static_cast<std::size_t> (alignment);
+        if (align < sizeof (void*))
+            align = sizeof (void*);
+
+       #if JUCE_WINDOWS
+        if (auto* ptr = _aligned_malloc (size > 0 ? size : 1, align))
+            return ptr;
+       #else
+        void* ptr = nullptr;
+        if (posix_memalign (&ptr, align, size > 0 ? size : 1) == 0)
+            return ptr;
+       #endif
+
+        throw std::bad_alloc();
+    }
+
+    void freeAligned (void* ptr) noexcept
+    {
+       #if JUCE_WINDOWS
+        _aligned_free (ptr);
+       #else
+        std::free (ptr);
+       #endif
+    }
+}
+
+void* operator new (std::size_t size)                                { return allocate (size); }
+void* operator new[] (std::size_t size)                              { return allocate (size); }
+void* operator new (std::size_t size, const std::nothrow_t&) noexcept   { try { return allocate (size); } catch (...) { return nullptr; } }
+void* operator new[] (std::size_t size, const std::nothrow_t&) noexcept { try { return allocate (size); } catch (...) { return nullptr; } }
+
+void operator delete (void* ptr) noexcept                            { std::free (ptr); }
+void operator delete[] (void* ptr) noexcept                          { std::free (ptr); }
+void operator delete (void* ptr, std::size_t) noexcept               { std::free (ptr); }
+void operator delete[] (void* ptr, std::size_t) noexcept             { std::free (ptr); }
+void operator delete (void* ptr, const std::nothrow_t&) noexcept     { std::free (ptr); }
+void operator delete[] (void* ptr, const std::nothrow_t&) noexcept   { std::free (ptr); }
+
+void* operator new (std::size_t size, std::align_val_t alignment)                                { return allocateAligned (size, alignment); }
+void* operator new[] (std::size_t size, std::align_val_t alignment)                              { return allocateAligned (size, alignment); }
+void* operator new (std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept   { try { return allocateAligned (size, alignment); } catch (...) { return nullptr; } }
+void* operator new[] (std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { try { return allocateAligned (size, alignment); } catch (...) { return nullptr; } }
+
+void operator delete (void* ptr, std::align_val_t) noexcept                            { freeAligned (ptr); }
+void operator delete[] (void* ptr, std::align_val_t) noexcept                          { freeAligned (ptr); }
+void operator delete (void* ptr, std::size_t, std::align_val_t) noexcept               { freeAligned (ptr); }
+void operator delete[] (void* ptr, std::size_t, std::align_val_t) noexcept             { freeAligned (ptr); }
+void operator delete (void* ptr, std::align_val_t, const std::nothrow_t&) noexcept     { freeAligned (ptr); }
+void operator delete[] (void* ptr, std::align_val_t, const std::nothrow_t&) noexcept   { freeAligned (ptr); }
+
+#endif
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+// Whether AllocationTrap.cpp replaces operator new with the asserting version
+#if JUCE_DEBUG && defined(ENABLE_ALLOCATION_TRAP)
+    #define GRIDDY_ALLOCATION_TRAP 1
+#else
+    #define GRIDDY_ALLOCATION_TRAP 0
+#endif
+
+/**
+ * ScopedAllocationTrap - Debug check that a scope never touches the heap
+ *
+ * While a trap is alive on a thread, the replacement operator new in
+ * AllocationTrap.cpp hits an assertion. processBlock holds one for its whole
+ * body, so an allocation on the audio thread is caught the first time it
+ * happens rather than as an occasional dropout. Other builds only keep the
+ * per-thread depth (an increment per block), so a test can supply its own
+ * operator new and ask isArmed() in any configuration.
+ */
+class ScopedAllocationTrap
+{
+public:
+    ScopedAllocationTrap() noexcept { ++depth(); }
+    ~ScopedAllocationTrap() noexcept { --depth(); }
+
+    static bool isArmed() noexcept { return depth() > 0; }
+
+    // Allocations caught so far on any thread, for tests that drive processBlock
+    static std::atomic<int>& caughtAllocations() noexcept
+    {
+        static std::atomic<int> count { 0 };
+        return count;
+    }
+
+    // Nesting depth of traps on the calling thread (negative while allocation is allowed)
+    static int& depth() noexcept
+    {
+        static thread_local int trapDepth = 0;
+        return trapDepth;
+    }
+
+    JUCE_DECLARE_NON_COPYABLE (ScopedAllocationTrap)
+};
+
+/**
+ * ScopedAllocationAllowed - Lifts the trap for calls we don't control
+ * (e.g. notifying the host of a parameter change)
+ */
+class ScopedAllocationAllowed
+{
+public:
+    ScopedAllocationAllowed() noexcept : savedDepth (ScopedAllocationTrap::depth()) { ScopedAllocationTrap::depth() = 0; }
+    ~ScopedAllocationAllowed() noexcept { ScopedAllocationTrap::depth() = savedDepth; }
+
+private:
+    int savedDepth;
+
+    JUCE_DECLARE_NON_COPYABLE (ScopedAllocationAllowed)
+};
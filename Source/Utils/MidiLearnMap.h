@@ -0,0 +1,142 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * MidiLearnMap - MIDI CC to parameter assignments
+ *
+ * One atomic slot per controller holds the index of the parameter it drives
+ * (in AudioProcessor::getParameters() order), so the audio thread resolves
+ * incoming CCs without locks while the UI learns or clears assignments.
+ * Each parameter is driven by at most one controller.
+ */
+class MidiLearnMap
+{
+public:
+    static constexpr int kNumControllers = 128;
+    static constexpr int kNone = -1;
+
+    MidiLearnMap()
+    {
+        for (auto& slot : parameterForController)
+            slot.store(kNone, std::memory_order_relaxed);
+    }
+
+    //==============================================================================
+    // Learning - the next CC received is assigned to the parameter
+    void startLearning(int parameterIndex) { learningParameter.store(parameterIndex); }
+    void stopLearning() { learningParameter.store(kNone); }
+    bool isLearning() const { return learningParameter.load() != kNone; }
+    int getLearningParameter() const { return learningParameter.load(); }
+
+    //==============================================================================
+    void assign(int controller, int parameterIndex)
+    {
+        if (!isValidController(controller))
+            return;
+
+        // A parameter follows one controller - drop any older assignment
+        for (auto& slot : parameterForController)
+        {
+            int expected = parameterIndex;
+            slot.compare_exchange_strong(expected, kNone, std::memory_order_relaxed);
+        }
+
+        parameterForController[static_cast<size_t>(controller)].store(parameterIndex, std::memory_order_release);
+    }
+
+    void clearController(int controller)
+    {
+        if (isValidController(controller))
+            parameterForController[static_cast<size_t>(controller)].store(kNone, std::memory_order_release);
+    }
+
+    void clearAll()
+    {
+        for (auto& slot : parameterForController)
+            slot.store(kNone, std::memory_order_release);
+    }
+
+    int getParameterForController(int controller) const
+    {
+        return isValidController(controller)
+            ? parameterForController[static_cast<size_t>(controller)].load(std::memory_order_acquire)
+            : kNone;
+    }
+
+    int getControllerForParameter(int parameterIndex) const
+    {
+        for (int controller = 0; controller < kNumControllers; ++controller)
+            if (getParameterForController(controller) == parameterIndex)
+                return controller;
+        return kNone;
+    }
+
+    //==============================================================================
+    /**
+     * Audio thread: resolves an incoming controller to its parameter index.
+     * While learning, the controller is assigned instead and kNone is returned,
+     * so the learning message itself doesn't move the parameter.
+     */
+    int handleController(int controller)
+    {
+        if (learningParameter.load(std::memory_order_relaxed) != kNone)
+        {
+            int parameterIndex = learningParameter.exchange(kNone);
+            if (parameterIndex != kNone)
+            {
+                assign(controller, parameterIndex);
+                return kNone;
+            }
+        }
+
+        return getParameterForController(controller);
+    }
+
+    //==============================================================================
+    // State - assignments are stored by parameter ID so they survive layout changes
+    void saveToValueTree(juce::ValueTree& tree, const juce::Array<juce::AudioProcessorParameter*>& parameters) const
+    {
+        tree.removeAllChildren(nullptr);
+
+        for (int controller = 0; controller < kNumControllers; ++controller)
+        {
+            int parameterIndex = getParameterForController(controller);
+            auto* parameter = dynamic_cast<juce::AudioProcessorParameterWithID*>(parameters[parameterIndex]);
+            if (parameter == nullptr)
+                continue;
+
+            juce::ValueTree mapping("Mapping");
+            mapping.setProperty("cc", controller, nullptr);
+            mapping.setProperty("parameter", parameter->paramID, nullptr);
+            tree.appendChild(mapping, nullptr);
+        }
+    }
+
+    void loadFromValueTree(const juce::ValueTree& tree, const juce::Array<juce::AudioProcessorParameter*>& parameters)
+    {
+        clearAll();
+
+        for (const auto& mapping : tree)
+        {
+            auto parameterID = mapping.getProperty("parameter").toString();
+            for (int index = 0; index < parameters.size(); ++index)
+            {
+                auto* parameter = dynamic_cast<juce::AudioProcessorParameterWithID*>(parameters[index]);
+                if (parameter != nullptr && parameter->paramID == parameterID)
+                {
+                    assign(mapping.getProperty("cc", kNone), index);
+                    break;
+                }
+            }
+        }
+    }
+
+private:
+    static bool isValidController(int controller) { return controller >= 0 && controller < kNumControllers; }
+
+    std::array<std::atomic<int>, kNumControllers> parameterForController;
+    std::atomic<int> learningParameter { kNone };
+
+    JUCE_DECLARE_NON_COPYABLE (MidiLearnMap)
+};
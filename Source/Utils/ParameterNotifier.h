@@ -0,0 +1,63 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * ParameterNotifier - Hands parameter changes from the audio thread to the host
+ *
+ * setValueNotifyingHost() can take locks and call listeners synchronously in
+ * some hosts, so the audio thread only stores the new value in an atomic
+ * slot. A message-thread timer sends pending values to the host as a
+ * complete change gesture. If several values are posted between ticks, only
+ * the latest one is sent.
+ */
+class ParameterNotifier : private juce::Timer
+{
+public:
+    explicit ParameterNotifier(juce::AudioProcessor& processor)
+        : parameters(processor.getParameters()),
+          slots(static_cast<size_t>(parameters.size()))
+    {
+        startTimerHz(60);
+    }
+
+    ~ParameterNotifier() override { stopTimer(); }
+
+    // Audio thread: queue a normalised (0-1) value for a parameter index
+    void post(int parameterIndex, float normalisedValue) noexcept
+    {
+        if (parameterIndex < 0 || parameterIndex >= static_cast<int>(slots.size()))
+            return;
+
+        auto& slot = slots[static_cast<size_t>(parameterIndex)];
+        slot.value.store(normalisedValue, std::memory_order_relaxed);
+        slot.pending.store(true, std::memory_order_release);
+    }
+
+private:
+    void timerCallback() override
+    {
+        for (size_t index = 0; index < slots.size(); ++index)
+        {
+            auto& slot = slots[index];
+            if (!slot.pending.exchange(false, std::memory_order_acquire))
+                continue;
+
+            auto* parameter = parameters[static_cast<int>(index)];
+            parameter->beginChangeGesture();
+            parameter->setValueNotifyingHost(slot.value.load(std::memory_order_relaxed));
+            parameter->endChangeGesture();
+        }
+    }
+
+    struct Slot
+    {
+        std::atomic<float> value { 0.0f };
+        std::atomic<bool> pending { false };
+    };
+
+    const juce::Array<juce::AudioProcessorParameter*> parameters;
+    std::vector<Slot> slots;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterNotifier)
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Grids/GridsEngine.h"
+
+/**
+ * Telemetry records sent from the audio thread to the UI.
+ *
+ * Step:    a step was played; triggers/accents are voice bitsets,
+ *          velocities are per voice.
+ * Reset:   the pattern was reset; `retrigger` tells which reset mode.
+ * Pattern: the 32-step trigger/accent masks of `voice` changed. They arrive
+ *          as a set of `numVoices` records, one per voice.
+ * Lookahead: the hits `voice` will play over the rendered window starting at
+ *          pattern step `step`; bit i of triggers is step + i.
+ */
+struct TelemetryEvent
+{
+    enum Type : uint8_t { Step, Reset, Pattern, Lookahead };
+
+    Type type = Step;
+    uint8_t step = 0;        // Pattern step (0-31)
+    uint8_t voice = 0;       // Pattern and Lookahead records
+    uint8_t numVoices = 0;   // Pattern records only
+    bool retrigger = false;  // Reset records only
+    uint32_t triggers = 0;
+    uint32_t accents = 0;
+    std::array<uint8_t, GridsEngine::kMaxVoices> velocities {};
+};
+
+/**
+ * TelemetryQueue - Single-producer/single-consumer lock-free FIFO
+ *
+ * The audio thread pushes, the editor's timer drains. Storage is fixed, so
+ * pushing never allocates or blocks; when the UI falls behind, new records
+ * are dropped rather than overwriting ones the reader may be copying.
+ */
+template <typename T, int Capacity>
+class SpscQueue
+{
+public:
+    // Producer side. Returns false if the queue is full
+    bool push(const T& item) noexcept
+    {
+        auto scope = fifo.write(1);
+        if (scope.blockSize1 > 0)
+            items[static_cast<size_t>(scope.startIndex1)] = item;
+        else if (scope.blockSize2 > 0)
+            items[static_cast<size_t>(scope.startIndex2)] = item;
+        else
+            return false;
+        return true;
+    }
+
+    // Producer side. Room for at least n more items
+    bool hasSpaceFor(int n) const noexcept { return fifo.getFreeSpace() >= n; }
+
+    // Consumer side. Returns false if the queue is empty
+    bool pop(T& item) noexcept
+    {
+        auto scope = fifo.read(1);
+        if (scope.blockSize1 > 0)
+            item = items[static_cast<size_t>(scope.startIndex1)];
+        else if (scope.blockSize2 > 0)
+            item = items[static_cast<size_t>(scope.startIndex2)];
+        else
+            return false;
+        return true;
+    }
+
+private:
+    juce::AbstractFifo fifo { Capacity };
+    std::array<T, static_cast<size_t>(Capacity)> items {};
+};
+
+using TelemetryQueue = SpscQueue<TelemetryEvent, 256>;
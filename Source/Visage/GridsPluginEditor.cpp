@@ -2,8 +2,7 @@
 #include "../MaterialIcons.h"
 
 GridsPluginEditor::GridsPluginEditor(GridsAudioProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), gridsEngine(p.getGridsEngine()),
-      ledMatrix(gridsEngine)
+    : AudioProcessorEditor(&p), audioProcessor(p)
 {
     DBG("GridsPluginEditor constructor started");
     
@@ -22,16 +21,12 @@ GridsPluginEditor::GridsPluginEditor(GridsAudioProcessor& p)
     // LED Matrix display
     addAndMakeVisible(ledMatrix);
     
-    // Set up XY pad callback to update parameters and engine
+    // Set up XY pad callback to update parameters
     xyPad.onValueChange = [this](float x, float y) {
         if (auto* xParam = audioProcessor.parameters.getParameter("x"))
             xParam->setValueNotifyingHost(xParam->convertTo0to1(x));
         if (auto* yParam = audioProcessor.parameters.getParameter("y"))
             yParam->setValueNotifyingHost(yParam->convertTo0to1(y));
-        
-        // Update the engine immediately so LED matrix updates even when not playing
-        audioProcessor.getGridsEngine().setX(x);
-        audioProcessor.getGridsEngine().setY(y);
     };
     
     // Initialize XY pad with current parameter values
@@ -42,7 +37,6 @@ GridsPluginEditor::GridsPluginEditor(GridsAudioProcessor& p)
     // Density Controls - without value text boxes
     bdDensitySlider.setSliderStyle(juce::Slider::LinearVertical);
     bdDensitySlider.setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
-    bdDensitySlider.addListener(this);  // Add listener to update engine
     addAndMakeVisible(bdDensitySlider);
     bdDensityLabel.setText("BD", juce::dontSendNotification);
     bdDensityLabel.setJustificationType(juce::Justification::centred);
@@ -50,7 +44,6 @@ GridsPluginEditor::GridsPluginEditor(GridsAudioProcessor& p)
     
     sdDensitySlider.setSliderStyle(juce::Slider::LinearVertical);
     sdDensitySlider.setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
-    sdDensitySlider.addListener(this);  // Add listener to update engine
     addAndMakeVisible(sdDensitySlider);
     sdDensityLabel.setText("SD", juce::dontSendNotification);
     sdDensityLabel.setJustificationType(juce::Justification::centred);
@@ -58,7 +51,6 @@ GridsPluginEditor::GridsPluginEditor(GridsAudioProcessor& p)
     
     hhDensitySlider.setSliderStyle(juce::Slider::LinearVertical);
     hhDensitySlider.setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
-    hhDensitySlider.addListener(this);  // Add listener to update engine
     addAndMakeVisible(hhDensitySlider);
     hhDensityLabel.setText("HH", juce::dontSendNotification);
     hhDensityLabel.setJustificationType(juce::Justification::centred);
@@ -67,7 +59,6 @@ GridsPluginEditor::GridsPluginEditor(GridsAudioProcessor& p)
     // Modulation - without value text boxes
     chaosSlider.setSliderStyle(juce::Slider::RotaryVerticalDrag);
     chaosSlider.setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
-    chaosSlider.addListener(this);  // Add listener to update engine
     addAndMakeVisible(chaosSlider);
     chaosLabel.setText("Chaos", juce::dontSendNotification);
     chaosLabel.setJustificationType(juce::Justification::centred);
@@ -75,7 +66,6 @@ GridsPluginEditor::GridsPluginEditor(GridsAudioProcessor& p)
     
     swingSlider.setSliderStyle(juce::Slider::RotaryVerticalDrag);
     swingSlider.setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
-    swingSlider.addListener(this);  // Add listener to update engine
     addAndMakeVisible(swingSlider);
     swingLabel.setText("Swing", juce::dontSendNotification);
     swingLabel.setJustificationType(juce::Justification::centred);
@@ -189,12 +179,18 @@ GridsPluginEditor::GridsPluginEditor(GridsAudioProcessor& p)
     setVisible(true);
     setWantsKeyboardFocus(true);
     
-    // Start timer to update XY pad from parameter changes
+    // Records left over from a previous editor are stale; the pattern is republished
+    TelemetryEvent stale;
+    while (audioProcessor.getTelemetry().pop(stale)) {}
+    audioProcessor.setTelemetryActive(true);
+    
+    // Start timer to update XY pad from parameter changes and drain telemetry
     startTimerHz(30);
 }
 
 GridsPluginEditor::~GridsPluginEditor()
 {
+    audioProcessor.setTelemetryActive(false);
     stopTimer();
     setLookAndFeel(nullptr);
 }
@@ -366,15 +362,35 @@ void GridsPluginEditor::timerCallback()
 #endif
 #else
     // Update XY pad position from parameters
-    auto xValue = audioProcessor.parameters.getRawParameterValue("x")->load();
-    auto yValue = audioProcessor.parameters.getRawParameterValue("y")->load();
+    auto xValue = audioProcessor.getParameterRefs().x->load();
+    auto yValue = audioProcessor.getParameterRefs().y->load();
     xyPad.setValues(xValue, yValue);
 #endif
     
-    // Check if reset occurred and trigger LED matrix animation
-    if (audioProcessor.hasResetOccurred())
+    drainTelemetry();
+}
+
+void GridsPluginEditor::drainTelemetry()
+{
+    TelemetryEvent event;
+    while (audioProcessor.getTelemetry().pop(event))
     {
-        ledMatrix.triggerReset(audioProcessor.wasResetRetrigger());
+        switch (event.type)
+        {
+            case TelemetryEvent::Step:
+                ledMatrix.setCurrentStep(event.step);
+                break;
+            case TelemetryEvent::Pattern:
+                ledMatrix.setNumVoices(event.numVoices);
+                ledMatrix.setPattern(event.voice, event.triggers, event.accents);
+                break;
+            case TelemetryEvent::Lookahead:
+                ledMatrix.setLookahead(event.voice, event.step, event.triggers);
+                break;
+            case TelemetryEvent::Reset:
+                ledMatrix.triggerReset(event.retrigger);
+                break;
+        }
     }
 }
 
@@ -394,26 +410,6 @@ void GridsPluginEditor::mouseExit(const juce::MouseEvent& event) {
     }
 }
 
-void GridsPluginEditor::sliderValueChanged(juce::Slider* slider) {
-    // Update the engine immediately when sliders change
-    // This ensures the LED matrix updates even when DAW is not playing
-    if (slider == &bdDensitySlider) {
-        gridsEngine.setBDDensity(slider->getValue());
-    }
-    else if (slider == &sdDensitySlider) {
-        gridsEngine.setSDDensity(slider->getValue());
-    }
-    else if (slider == &hhDensitySlider) {
-        gridsEngine.setHHDensity(slider->getValue());
-    }
-    else if (slider == &chaosSlider) {
-        gridsEngine.setChaos(slider->getValue());
-    }
-    else if (slider == &swingSlider) {
-        gridsEngine.setSwing(slider->getValue());
-    }
-}
-
 void GridsPluginEditor::mouseDown(const juce::MouseEvent& event) {
     if (settingsButtonBounds.contains(event.getPosition())) {
         openSettings();
@@ -8,8 +8,7 @@
 #include "VisageSettingsPanel.h"
 
 class GridsPluginEditor : public juce::AudioProcessorEditor,
-                         private juce::Timer,
-                         private juce::Slider::Listener
+                         private juce::Timer
 {
 public:
     explicit GridsPluginEditor(GridsAudioProcessor&);
@@ -27,15 +26,14 @@ public:
     void mouseExit(const juce::MouseEvent& event) override;
     void mouseDown(const juce::MouseEvent& event) override;
     
-    // Slider listener
-    void sliderValueChanged(juce::Slider* slider) override;
-    
     // Open settings panel
     void openSettings();
 
 private:
     GridsAudioProcessor& audioProcessor;
-    GridsEngine& gridsEngine;
+    
+    // Apply the steps, pattern changes and resets the audio thread has published
+    void drainTelemetry();
     
     // Custom look and feel
     VisageLookAndFeel visageLookAndFeel;
@@ -1,9 +1,8 @@
 #include "LEDMatrix.h"
 
-LEDMatrix::LEDMatrix(GridsEngine& engine) : gridsEngine(engine)
+LEDMatrix::LEDMatrix()
 {
     startTimerHz(30); // Update at 30fps
-    updatePattern();
 }
 
 LEDMatrix::~LEDMatrix()
@@ -23,19 +22,22 @@ void LEDMatrix::paint(juce::Graphics& g)
     g.setColour(juce::Colour(0xff202020));
     g.drawRoundedRectangle(bounds.reduced(1.0f), 6.0f, 1.0f);
     
-    // Draw the 32x3 LED matrix - vertically centered with 10px padding
+    // Draw the 32-step LED matrix, one row per voice - vertically centered
     const float startX = 20.0f;
-    const float matrixHeight = rowSpacing * 2 + ledSize;
+    const float matrixHeight = rowSpacing * (numVoices - 1) + ledSize;
     const float startY = (bounds.getHeight() - matrixHeight) * 0.5f;
     
     // Draw labels
     g.setColour(juce::Colour(0x80ffffff));
-    g.setFont(10.0f);
+    g.setFont(juce::jmin(10.0f, rowSpacing));
     
     // Row labels
-    g.drawText("BD", 5, startY - 2, 25, 15, juce::Justification::left);
-    g.drawText("SD", 5, startY + rowSpacing - 2, 25, 15, juce::Justification::left);
-    g.drawText("HH", 5, startY + rowSpacing * 2 - 2, 25, 15, juce::Justification::left);
+    static const char* const drumLabels[] = { "BD", "SD", "HH" };
+    for (int voice = 0; voice < numVoices; ++voice)
+    {
+        const auto label = voice < 3 ? juce::String(drumLabels[voice]) : "V" + juce::String(voice + 1);
+        g.drawText(label, 5, startY + rowSpacing * voice - 2, 25, 15, juce::Justification::left);
+    }
     
     // Draw LEDs in 4 groups of 8
     for (int group = 0; group < 4; ++group)
@@ -47,7 +49,7 @@ void LEDMatrix::paint(juce::Graphics& g)
         {
             g.setColour(juce::Colour(0x30ffffff));
             float sepX = groupX - 8.0f;
-            g.drawLine(sepX, startY - 8, sepX, startY + rowSpacing * 2 + ledSize + 3, 0.75f);
+            g.drawLine(sepX, startY - 8, sepX, startY + matrixHeight + 3, 0.75f);
         }
         
         // Draw bar numbers for each group
@@ -63,24 +65,33 @@ void LEDMatrix::paint(juce::Graphics& g)
             int globalStep = group * 8 + step;
             float x = groupX + step * ledSpacing;
             
-            // BD row
-            drawLED(g, x, startY, getBDColour(globalStep), 
-                   bdPattern[globalStep], globalStep == currentStep);
-            
-            // SD row
-            drawLED(g, x, startY + rowSpacing, getSDColour(globalStep), 
-                   sdPattern[globalStep], globalStep == currentStep);
-            
-            // HH row
-            drawLED(g, x, startY + rowSpacing * 2, getHHColour(globalStep), 
-                   hhPattern[globalStep], globalStep == currentStep);
+            for (int voice = 0; voice < numVoices; ++voice)
+            {
+                drawLED(g, x, startY + rowSpacing * voice, getVoiceColour(voice, globalStep),
+                        (patterns[voice] >> globalStep) & 1u, globalStep == currentStep,
+                        isUpcoming(voice, globalStep));
+            }
         }
     }
 }
 
 void LEDMatrix::resized()
 {
-    // Nothing special needed
+    updateRowLayout();
+}
+
+void LEDMatrix::updateRowLayout()
+{
+    // Up to three rows at the original spacing; more rows shrink to fit the
+    // height left under the bar numbers
+    rowSpacing = 25.0f;
+    ledSize = 10.0f;
+    if (numVoices > 3)
+    {
+        const float available = juce::jmax(0.0f, static_cast<float>(getHeight()) - 40.0f);
+        rowSpacing = juce::jmin(rowSpacing, available / static_cast<float>(numVoices));
+        ledSize = juce::jmin(ledSize, rowSpacing * 0.8f);
+    }
 }
 
 void LEDMatrix::setCurrentStep(int step)
@@ -101,71 +112,52 @@ void LEDMatrix::triggerReset(bool isRetrigger)
     repaint();
 }
 
-void LEDMatrix::updatePattern()
+void LEDMatrix::setNumVoices(int newNumVoices)
 {
-    // Get the actual pattern from the Grids engine
-    auto bdPatternData = gridsEngine.getBDPattern();
-    auto sdPatternData = gridsEngine.getSDPattern();
-    auto hhPatternData = gridsEngine.getHHPattern();
-    
-    // Get density values for thresholding
-    float bdDensity = gridsEngine.getBDDensity();
-    float sdDensity = gridsEngine.getSDDensity();
-    float hhDensity = gridsEngine.getHHDensity();
-    
-    // Convert pattern data to boolean triggers based on density
-    for (int i = 0; i < 32; ++i)
+    newNumVoices = juce::jlimit(1, GridsEngine::kMaxVoices, newNumVoices);
+    if (numVoices != newNumVoices)
     {
-        // Apply density threshold - higher values in pattern data mean more likely to trigger
-        uint8_t bdThreshold = static_cast<uint8_t>(255 * (1.0f - bdDensity));
-        uint8_t sdThreshold = static_cast<uint8_t>(255 * (1.0f - sdDensity));
-        uint8_t hhThreshold = static_cast<uint8_t>(255 * (1.0f - hhDensity));
-        
-        bdPattern[i] = bdPatternData[i] > bdThreshold;
-        sdPattern[i] = sdPatternData[i] > sdThreshold;
-        hhPattern[i] = hhPatternData[i] > hhThreshold;
-        
-        // Accents from Grids: values > 200 are accented (matching GridsEngine logic)
-        bdAccents[i] = bdPatternData[i] > 200 && bdPattern[i];
-        sdAccents[i] = sdPatternData[i] > 200 && sdPattern[i];
-        hhAccents[i] = hhPatternData[i] > 200 && hhPattern[i];
+        numVoices = newNumVoices;
+        updateRowLayout();
+        repaint();
     }
-    
-    repaint();
 }
 
-void LEDMatrix::timerCallback()
+void LEDMatrix::setPattern(int voice, uint32_t triggerMask, uint32_t accentMask)
 {
-    // Update current step from engine
-    int newStep = gridsEngine.getCurrentStep();
+    if (voice < 0 || voice >= numVoices)
+        return;
     
-    // Check if X/Y or density parameters have changed
-    float currentX = gridsEngine.getX();
-    float currentY = gridsEngine.getY();
-    float currentBDDensity = gridsEngine.getBDDensity();
-    float currentSDDensity = gridsEngine.getSDDensity();
-    float currentHHDensity = gridsEngine.getHHDensity();
+    // Accents are shown only where the voice triggers
+    patterns[static_cast<size_t>(voice)] = triggerMask;
+    accents[static_cast<size_t>(voice)] = accentMask & triggerMask;
     
-    bool parametersChanged = (std::abs(currentX - lastX) > 0.001f || 
-                              std::abs(currentY - lastY) > 0.001f ||
-                              std::abs(currentBDDensity - lastBDDensity) > 0.001f ||
-                              std::abs(currentSDDensity - lastSDDensity) > 0.001f ||
-                              std::abs(currentHHDensity - lastHHDensity) > 0.001f);
+    repaint();
+}
+
+void LEDMatrix::setLookahead(int voice, int firstStep, uint32_t triggerMask)
+{
+    if (voice < 0 || voice >= numVoices)
+        return;
     
-    // Update patterns when parameters change, step changes, or periodically
-    static int updateCounter = 0;
-    if (newStep != currentStep || parametersChanged || ++updateCounter > 15)
-    {
-        currentStep = newStep;
-        updateCounter = 0;
-        lastX = currentX;
-        lastY = currentY;
-        lastBDDensity = currentBDDensity;
-        lastSDDensity = currentSDDensity;
-        lastHHDensity = currentHHDensity;
-        updatePattern();
-    }
+    lookaheadStart = ((firstStep % 32) + 32) % 32;
+    lookaheadTriggers[static_cast<size_t>(voice)] = triggerMask & ((1u << kLookaheadWindow) - 1u);
+    repaint();
+}
+
+bool LEDMatrix::isUpcoming(int voice, int step) const
+{
+    // Only the part of the window after the playhead is still to come
+    const int position = (step - lookaheadStart + 32) % 32;
+    const int played = (currentStep - lookaheadStart + 32) % 32;
+    if (position >= kLookaheadWindow || (played < kLookaheadWindow && position <= played))
+        return false;
     
+    return (lookaheadTriggers[static_cast<size_t>(voice)] >> position) & 1u;
+}
+
+void LEDMatrix::timerCallback()
+{
     // Update reset animation
     if (isResetting)
     {
@@ -175,72 +167,37 @@ void LEDMatrix::timerCallback()
             isResetting = false;
             resetAnimationProgress = 0.0f;
         }
+        
+        repaint();
     }
-    
-    repaint();
-}
-
-juce::Colour LEDMatrix::getBDColour(int step) const
-{
-    if (bdPattern[step])
-    {
-#ifdef ENABLE_VELOCITY_SYSTEM
-        // Vary brightness based on accent for velocity visualization
-        if (bdAccents[step])
-            return juce::Colour(0xffff6666); // Much brighter red for accented
-        else
-            return juce::Colour(0xff991111); // Much dimmer red for normal
-#else
-        if (bdAccents[step])
-            return juce::Colour(0xffff4444); // Bright red for accented
-        else
-            return juce::Colour(0xffcc2222); // Red for normal
-#endif
-    }
-    return juce::Colour(0xff331111); // Dark red for off
-}
-
-juce::Colour LEDMatrix::getSDColour(int step) const
-{
-    if (sdPattern[step])
-    {
-#ifdef ENABLE_VELOCITY_SYSTEM
-        // Vary brightness based on accent for velocity visualization
-        if (sdAccents[step])
-            return juce::Colour(0xff66ff66); // Much brighter green for accented
-        else
-            return juce::Colour(0xff119911); // Much dimmer green for normal
-#else
-        if (sdAccents[step])
-            return juce::Colour(0xff44ff44); // Bright green for accented
-        else
-            return juce::Colour(0xff22cc22); // Green for normal
-#endif
-    }
-    return juce::Colour(0xff113311); // Dark green for off
 }
 
-juce::Colour LEDMatrix::getHHColour(int step) const
+juce::Colour LEDMatrix::getVoiceColour(int voice, int step) const
 {
-    if (hhPattern[step])
-    {
+    // Per colour: accented, normal, and off. The velocity system spreads
+    // accented and normal further apart to show velocity
+    struct Palette { juce::uint32 accented, normal, off; };
+    static constexpr Palette palettes[] = {
 #ifdef ENABLE_VELOCITY_SYSTEM
-        // Vary brightness based on accent for velocity visualization
-        if (hhAccents[step])
-            return juce::Colour(0xffffff66); // Much brighter yellow for accented
-        else
-            return juce::Colour(0xff999911); // Much dimmer yellow for normal
+        { 0xffff6666, 0xff991111, 0xff331111 },  // Red (BD)
+        { 0xff66ff66, 0xff119911, 0xff113311 },  // Green (SD)
+        { 0xffffff66, 0xff999911, 0xff333311 },  // Yellow (HH)
 #else
-        if (hhAccents[step])
-            return juce::Colour(0xffffff44); // Bright yellow for accented
-        else
-            return juce::Colour(0xffcccc22); // Yellow for normal
+        { 0xffff4444, 0xffcc2222, 0xff331111 },  // Red (BD)
+        { 0xff44ff44, 0xff22cc22, 0xff113311 },  // Green (SD)
+        { 0xffffff44, 0xffcccc22, 0xff333311 },  // Yellow (HH)
 #endif
-    }
-    return juce::Colour(0xff333311); // Dark yellow for off
+    };
+    
+    const auto& palette = palettes[voice % 3];
+    if (!((patterns[static_cast<size_t>(voice)] >> step) & 1u))
+        return juce::Colour(palette.off);
+    
+    return juce::Colour((accents[static_cast<size_t>(voice)] >> step) & 1u ? palette.accented : palette.normal);
 }
 
-void LEDMatrix::drawLED(juce::Graphics& g, float x, float y, juce::Colour colour, bool isActive, bool isCurrent)
+void LEDMatrix::drawLED(juce::Graphics& g, float x, float y, juce::Colour colour, bool isActive, bool isCurrent,
+                        bool isUpcoming)
 {
     // Apply reset animation effects
     if (isResetting)
@@ -291,6 +248,13 @@ void LEDMatrix::drawLED(juce::Graphics& g, float x, float y, juce::Colour colour
         g.fillEllipse(x + 2, y + 2, ledSize - 4, ledSize - 4);
     }
     
+    // Ring the hits the lookahead says are coming next
+    if (isUpcoming && !isCurrent)
+    {
+        g.setColour(colour.brighter(0.3f).withAlpha(0.7f));
+        g.drawEllipse(x - 1.5f, y - 1.5f, ledSize + 3, ledSize + 3, 1.0f);
+    }
+    
     // Draw current step indicator
     if (isCurrent)
     {
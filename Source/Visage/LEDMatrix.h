@@ -3,43 +3,48 @@
 #include <JuceHeader.h>
 #include "../Grids/GridsEngine.h"
 
+/**
+ * LEDMatrix - 32-step display, one row per engine voice
+ *
+ * Purely a view: the editor feeds it steps, pattern masks, the rendered
+ * lookahead and resets drained from the processor's telemetry queue, so it
+ * never reads the engine. Hits still to come in the lookahead window get a
+ * ring, so steps the seed or chaos add or remove show before they play.
+ */
 class LEDMatrix : public juce::Component, private juce::Timer
 {
 public:
-    explicit LEDMatrix(GridsEngine& engine);
+    LEDMatrix();
     ~LEDMatrix() override;
     
     void paint(juce::Graphics& g) override;
     void resized() override;
     
     void setCurrentStep(int step);
-    void updatePattern();
+    void setNumVoices(int numVoices);
+    void setPattern(int voice, uint32_t triggerMask, uint32_t accentMask);
+    void setLookahead(int voice, int firstStep, uint32_t triggerMask);
     void triggerReset(bool isRetrigger);
     
 private:
     void timerCallback() override;
     
-    GridsEngine& gridsEngine;
-    
     int currentStep = 0;
-    std::array<bool, 32> bdPattern;
-    std::array<bool, 32> sdPattern;
-    std::array<bool, 32> hhPattern;
-    
-    std::array<bool, 32> bdAccents;
-    std::array<bool, 32> sdAccents;
-    std::array<bool, 32> hhAccents;
-    
-    // Track last parameter values to detect changes
-    float lastX = -1.0f;
-    float lastY = -1.0f;
-    float lastBDDensity = -1.0f;
-    float lastSDDensity = -1.0f;
-    float lastHHDensity = -1.0f;
-    
-    const float ledSize = 10.0f;
+    int numVoices = GridsEngine::kNumDrumVoices;
+    std::array<uint32_t, GridsEngine::kMaxVoices> patterns {};  // Bit i = step i
+    std::array<uint32_t, GridsEngine::kMaxVoices> accents {};
+    
+    // Rendered lookahead: bit i of a voice's mask is step lookaheadStart + i
+    static constexpr int kLookaheadWindow = 16;
+    int lookaheadStart = 0;
+    std::array<uint32_t, GridsEngine::kMaxVoices> lookaheadTriggers {};
+    bool isUpcoming(int voice, int step) const;
+    
+    // Three rows keep the original size; more voices share the same height
+    float ledSize = 10.0f;
     const float ledSpacing = 14.0f;
-    const float rowSpacing = 25.0f;
+    float rowSpacing = 25.0f;
+    void updateRowLayout();
     
     // Reset animation
     bool isResetting = false;
@@ -47,11 +52,11 @@ private:
     float resetAnimationProgress = 0.0f;
     int lastResetStep = -1;
     
-    juce::Colour getBDColour(int step) const;
-    juce::Colour getSDColour(int step) const;
-    juce::Colour getHHColour(int step) const;
+    // Voices past HH reuse the BD/SD/HH colours in turn
+    juce::Colour getVoiceColour(int voice, int step) const;
     
-    void drawLED(juce::Graphics& g, float x, float y, juce::Colour colour, bool isActive, bool isCurrent);
+    void drawLED(juce::Graphics& g, float x, float y, juce::Colour colour, bool isActive, bool isCurrent,
+                 bool isUpcoming);
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LEDMatrix)
 };
\ No newline at end of file
@@ -593,6 +593,27 @@ std::unique_ptr<juce::Component> VisageSettingsPanel::createAdvancedTabContent()
             };
             addAndMakeVisible(resetQuantizeBox);
             
+            // Clock Section
+            clockSectionLabel.setText("Clock", juce::dontSendNotification);
+            clockSectionLabel.setFont(juce::Font(14.0f, juce::Font::bold));
+            clockSectionLabel.setColour(juce::Label::textColourId, juce::Colour(0xffdddddd));
+            addAndMakeVisible(clockSectionLabel);
+            
+            clockSourceBox.addItemList(audioProcessor.parameters.getParameter("clock_source")->getAllValueStrings(), 1);
+            clockSourceBox.setColour(juce::ComboBox::backgroundColourId, juce::Colour(0xff2a2a2a));
+            clockSourceBox.setColour(juce::ComboBox::textColourId, juce::Colour(0xffcccccc));
+            addAndMakeVisible(clockSourceBox);
+            clockSourceAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+                audioProcessor.parameters, "clock_source", clockSourceBox);
+            
+            internalBpmSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+            internalBpmSlider.setTextBoxStyle(juce::Slider::TextBoxRight, false, 70, 20);
+            internalBpmSlider.setTextValueSuffix(" BPM");
+            internalBpmSlider.setColour(juce::Slider::textBoxTextColourId, juce::Colour(0xffcccccc));
+            addAndMakeVisible(internalBpmSlider);
+            internalBpmAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+                audioProcessor.parameters, "internal_bpm", internalBpmSlider);
+            
             // MIDI Learn section
             midiLearnLabel.setText("MIDI Learn", juce::dontSendNotification);
             midiLearnLabel.setFont(juce::Font(14.0f, juce::Font::bold));
@@ -653,7 +674,7 @@ std::unique_ptr<juce::Component> VisageSettingsPanel::createAdvancedTabContent()
             bdLengthLabel.setColour(juce::Label::textColourId, juce::Colour(0xffcccccc));
             addAndMakeVisible(bdLengthLabel);
             
-            for (int i = 1; i <= 32; ++i)
+            for (int i = 1; i <= EuclideanEngine::kMaxLength; ++i)
                 bdLengthBox.addItem(juce::String(i) + " steps", i);
             bdLengthBox.setSelectedId(settings.getInt(SettingsManager::Keys::euclideanBDLength, 16));
             bdLengthBox.setColour(juce::ComboBox::backgroundColourId, juce::Colour(0xff2a2a2a));
@@ -670,7 +691,7 @@ std::unique_ptr<juce::Component> VisageSettingsPanel::createAdvancedTabContent()
             sdLengthLabel.setColour(juce::Label::textColourId, juce::Colour(0xffcccccc));
             addAndMakeVisible(sdLengthLabel);
             
-            for (int i = 1; i <= 32; ++i)
+            for (int i = 1; i <= EuclideanEngine::kMaxLength; ++i)
                 sdLengthBox.addItem(juce::String(i) + " steps", i);
             sdLengthBox.setSelectedId(settings.getInt(SettingsManager::Keys::euclideanSDLength, 12));
             sdLengthBox.setColour(juce::ComboBox::backgroundColourId, juce::Colour(0xff2a2a2a));
@@ -687,7 +708,7 @@ std::unique_ptr<juce::Component> VisageSettingsPanel::createAdvancedTabContent()
             hhLengthLabel.setColour(juce::Label::textColourId, juce::Colour(0xffcccccc));
             addAndMakeVisible(hhLengthLabel);
             
-            for (int i = 1; i <= 32; ++i)
+            for (int i = 1; i <= EuclideanEngine::kMaxLength; ++i)
                 hhLengthBox.addItem(juce::String(i) + " steps", i);
             hhLengthBox.setSelectedId(settings.getInt(SettingsManager::Keys::euclideanHHLength, 8));
             hhLengthBox.setColour(juce::ComboBox::backgroundColourId, juce::Colour(0xff2a2a2a));
@@ -706,7 +727,7 @@ std::unique_ptr<juce::Component> VisageSettingsPanel::createAdvancedTabContent()
             addAndMakeVisible(outputSectionLabel);
             
             gateModeBox.setButtonText("Gate Mode by default (sustained notes)");
-            gateModeBox.setToggleState(settings.getBool(SettingsManager::Keys::defaultGateMode, false),
+            gateModeBox.setToggleState(settings.getBool(SettingsManager::Keys::defaultGateMode, true),
                                       juce::dontSendNotification);
             gateModeBox.setColour(juce::ToggleButton::textColourId, juce::Colour(0xffcccccc));
             gateModeBox.setColour(juce::ToggleButton::tickColourId, juce::Colour(0xffff8833));
@@ -716,6 +737,38 @@ std::unique_ptr<juce::Component> VisageSettingsPanel::createAdvancedTabContent()
             };
             addAndMakeVisible(gateModeBox);
             
+            // Groove template (used when Swing Mode is set to Groove)
+            grooveLabel.setText("Groove: None", juce::dontSendNotification);
+            grooveLabel.setFont(juce::Font(12.0f));
+            grooveLabel.setColour(juce::Label::textColourId, juce::Colour(0xffcccccc));
+            addAndMakeVisible(grooveLabel);
+            
+            loadGrooveButton.setButtonText("Load Groove...");
+            loadGrooveButton.setColour(juce::TextButton::buttonColourId, juce::Colour(0xff2a2a2a));
+            loadGrooveButton.setColour(juce::TextButton::textColourOffId, juce::Colour(0xffcccccc));
+            loadGrooveButton.onClick = [this] {
+                grooveChooser = std::make_unique<juce::FileChooser>("Load Groove Template", juce::File(),
+                                                                    GrooveTemplate::kFilePatterns);
+                grooveChooser->launchAsync(juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles,
+                                           [this](const juce::FileChooser& chooser) {
+                    auto file = chooser.getResult();
+                    if (file == juce::File())
+                        return;
+                    
+                    auto error = audioProcessor.loadGroove(file);
+                    if (error.isNotEmpty())
+                        juce::AlertWindow::showMessageBoxAsync(juce::AlertWindow::WarningIcon,
+                                                               "Groove Template", error);
+                });
+            };
+            addAndMakeVisible(loadGrooveButton);
+            
+            clearGrooveButton.setButtonText("Clear");
+            clearGrooveButton.setColour(juce::TextButton::buttonColourId, juce::Colour(0xff2a2a2a));
+            clearGrooveButton.setColour(juce::TextButton::textColourOffId, juce::Colour(0xffcccccc));
+            clearGrooveButton.onClick = [this] { audioProcessor.clearGroove(); };
+            addAndMakeVisible(clearGrooveButton);
+            
 #ifdef ENABLE_PATTERN_CHAIN
             // Pattern Chaining Section
             chainSectionLabel.setText("Pattern Chaining", juce::dontSendNotification);
@@ -799,6 +852,14 @@ std::unique_ptr<juce::Component> VisageSettingsPanel::createAdvancedTabContent()
             resetQuantizeBox.setBounds(bounds.removeFromTop(30).removeFromLeft(200));
             bounds.removeFromTop(20);
             
+            // Clock Section
+            clockSectionLabel.setBounds(bounds.removeFromTop(20));
+            bounds.removeFromTop(10);
+            auto clockRow = bounds.removeFromTop(30);
+            clockSourceBox.setBounds(clockRow.removeFromLeft(150));
+            internalBpmSlider.setBounds(clockRow.removeFromLeft(250).translated(10, 0));
+            bounds.removeFromTop(20);
+            
             // MIDI Learn Section
             midiLearnLabel.setBounds(bounds.removeFromTop(20));
             bounds.removeFromTop(10);
@@ -838,6 +899,11 @@ std::unique_ptr<juce::Component> VisageSettingsPanel::createAdvancedTabContent()
             outputSectionLabel.setBounds(bounds.removeFromTop(20));
             bounds.removeFromTop(10);
             gateModeBox.setBounds(bounds.removeFromTop(24));
+            bounds.removeFromTop(5);
+            auto grooveRow = bounds.removeFromTop(30);
+            loadGrooveButton.setBounds(grooveRow.removeFromLeft(120));
+            clearGrooveButton.setBounds(grooveRow.removeFromLeft(60).translated(5, 0));
+            grooveLabel.setBounds(grooveRow.translated(15, 0));
             
 #ifdef ENABLE_PATTERN_CHAIN
             bounds.removeFromTop(20);
@@ -885,6 +951,10 @@ std::unique_ptr<juce::Component> VisageSettingsPanel::createAdvancedTabContent()
                 } else {
                     resetCCLabel.setText("Reset CC: None", juce::dontSendNotification);
                 }
+                
+                auto grooveName = processor->getGrooveName();
+                grooveLabel.setText("Groove: " + (grooveName.isNotEmpty() ? grooveName : juce::String("None")),
+                                    juce::dontSendNotification);
             }
         }
         
@@ -897,6 +967,12 @@ std::unique_ptr<juce::Component> VisageSettingsPanel::createAdvancedTabContent()
         juce::Label resetQuantizeLabel;
         juce::ComboBox resetQuantizeBox;
         
+        juce::Label clockSectionLabel;
+        juce::ComboBox clockSourceBox;
+        juce::Slider internalBpmSlider;
+        std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> clockSourceAttachment;
+        std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> internalBpmAttachment;
+        
         juce::Label midiLearnLabel;
         juce::TextButton resetMidiLearnButton;
         juce::Label resetCCLabel;
@@ -916,6 +992,10 @@ std::unique_ptr<juce::Component> VisageSettingsPanel::createAdvancedTabContent()
 #endif
         
         juce::ToggleButton gateModeBox;
+        juce::TextButton loadGrooveButton;
+        juce::TextButton clearGrooveButton;
+        juce::Label grooveLabel;
+        std::unique_ptr<juce::FileChooser> grooveChooser;
         
 #ifdef ENABLE_PATTERN_CHAIN
         juce::Label chainSectionLabel;
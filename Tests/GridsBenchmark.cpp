@@ -0,0 +1,208 @@
+#include <JuceHeader.h>
+#include "Grids/GridsEngine.h"
+#include "Timing/StepScheduler.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
+/**
+ * Micro-benchmarks for the audio-thread step path against what it replaced.
+ *
+ * Scheduling: the old PPQ branch of processBlock converted every sample to
+ * PPQ, loaded the swing parameter, took an fmod and worked out the target
+ * step. StepScheduler jumps to the step boundaries instead. Both run over
+ * 2048-sample blocks at 120 bpm / 48 kHz with swing.
+ *
+ * Pattern: the old engine read four node bytes and interpolated them in
+ * float for every voice on every step (readDrumMap). GridsEngine blends whole
+ * nodes into cached levels and masks once per X/Y change and renders steps
+ * from those. Measured with X/Y static, and with X moving on every step in
+ * both interpolation modes - the worst case for the cache, where every step
+ * pays for a rebuild that the old path never did - and with X ramping the way
+ * the processor applies automation, on the 8-bit grid.
+ *
+ * Run it from a Release build and compare the columns:
+ *     cmake --build build --config Release --target benchmark
+ */
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+volatile int64_t sink = 0;  // Keeps results observable so nothing is optimised away
+
+template <typename Body>
+double nanosecondsPer(int iterations, Body&& body)
+{
+    body();  // Warm up caches and lazily built state
+
+    const auto start = Clock::now();
+    for (int i = 0; i < iterations; ++i)
+        body();
+    const auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start);
+    return elapsed.count() / iterations;
+}
+
+void report(const char* name, double baseline, double current, const char* unit)
+{
+    std::printf("%-40s %10.1f ns/%s %10.1f ns/%s %7.1fx\n",
+                name, baseline, unit, current, unit, baseline / current);
+}
+
+//==============================================================================
+// The per-sample loop processBlock used before StepScheduler
+int64_t scanBlockPerSample(double blockPpq, double ppqPerSample, int numSamples,
+                           const std::atomic<float>& swingParameter, int& currentPatternStep)
+{
+    int64_t fired = 0;
+    for (int sample = 0; sample < numSamples; ++sample) {
+        const double samplePpq = blockPpq + sample * ppqPerSample;
+        const double swingValue = swingParameter.load();
+        double adjustedPpq = samplePpq;
+
+        if (swingValue != 0.5) {
+            const double beatPosition = std::fmod(samplePpq, 1.0);
+            const double swingOffset = (swingValue - 0.5) * 0.1;
+            if ((beatPosition > 0.20 && beatPosition < 0.30) || (beatPosition > 0.70 && beatPosition < 0.80))
+                adjustedPpq += swingOffset;
+        }
+
+        const auto absoluteStep = static_cast<int64_t>(adjustedPpq * 4.0);
+        const int targetStep = static_cast<int>(absoluteStep % 32);
+        if (targetStep != currentPatternStep) {
+            currentPatternStep = targetStep;
+            fired += absoluteStep + sample;
+        }
+    }
+    return fired;
+}
+
+void benchmarkScheduling()
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 2048;
+    constexpr double ppqPerSample = (120.0 / 60.0) / sampleRate;
+    constexpr int numBlocks = 2000;
+
+    const std::atomic<float> swingParameter { 0.62f };
+    StepScheduler scheduler;
+    scheduler.setSwing(swingParameter.load());
+
+    int currentPatternStep = -1;
+    const double perSample = nanosecondsPer(numBlocks, [&, ppq = 0.0]() mutable {
+        sink = sink + scanBlockPerSample(ppq, ppqPerSample, blockSize, swingParameter, currentPatternStep);
+        ppq += blockSize * ppqPerSample;
+    });
+
+    const double analytic = nanosecondsPer(numBlocks, [&, ppq = 0.0]() mutable {
+        int64_t fired = 0;
+        scheduler.processBlock(ppq, ppqPerSample, blockSize, false,
+                               [&](int sample, int64_t step) { fired += step + sample; });
+        sink = sink + fired;
+        ppq += blockSize * ppqPerSample;
+    });
+
+    report("Step scheduling, 2048-sample blocks", perSample, analytic, "block");
+}
+
+//==============================================================================
+// The per-step, per-voice path GridsEngine used before whole-node caching
+uint8_t readDrumMap(float x, float y, int instrument, int step)
+{
+    const float scaledX = x * 4.0f;
+    const float scaledY = y * 4.0f;
+    const int x0 = static_cast<int>(scaledX);
+    const int y0 = static_cast<int>(scaledY);
+    const int x1 = std::min(x0 + 1, 4);
+    const int y1 = std::min(y0 + 1, 4);
+    const float fx = scaledX - x0;
+    const float fy = scaledY - y0;
+    const int offset = instrument * 32 + step;
+
+    const float v0 = (*grids::node_table[y0 * 5 + x0])[offset] * (1.0f - fx) + (*grids::node_table[y0 * 5 + x1])[offset] * fx;
+    const float v1 = (*grids::node_table[y1 * 5 + x0])[offset] * (1.0f - fx) + (*grids::node_table[y1 * 5 + x1])[offset] * fx;
+    return static_cast<uint8_t>(v0 * (1.0f - fy) + v1 * fy);
+}
+
+int evaluateStepPerVoice(float x, float y, const float* densities, int64_t absoluteStep)
+{
+    int triggers = 0;
+    for (int voice = 0; voice < 3; ++voice) {
+        const uint8_t value = readDrumMap(x, y, voice, static_cast<int>(absoluteStep & 31));
+        const auto threshold = static_cast<uint8_t>((1.0f - densities[voice]) * 254.0f);
+        if (densities[voice] > 0.0f && value > threshold)
+            triggers += value > 200 ? 2 : 1;
+    }
+    return triggers;
+}
+
+void benchmarkPattern()
+{
+    constexpr int numSteps = 200000;
+    const float densities[] = { 0.7f, 0.5f, 0.8f };
+
+    GridsEngine engine;
+    engine.setX(0.3f);
+    engine.setY(0.6f);
+    for (int voice = 0; voice < 3; ++voice)
+        engine.setDensity(voice, densities[voice]);
+
+    std::array<GridsEngine::PatternEvent, 64> events {};
+
+    // X/Y static: the engine renders from its cached masks
+    const double perStepStatic = nanosecondsPer(numSteps, [&, step = int64_t { 0 }]() mutable {
+        sink = sink + evaluateStepPerVoice(0.3f, 0.6f, densities, step++);
+    });
+    const double renderStatic = nanosecondsPer(numSteps, [&, step = int64_t { 0 }]() mutable {
+        sink = sink + engine.renderSteps(step++, 1, events.data(), static_cast<int>(events.size()));
+    });
+    report("Pattern step, X/Y static", perStepStatic, renderStatic, "step");
+
+    // A lookahead bar at a time, as renderLookahead asks for it
+    const double perBarStatic = nanosecondsPer(numSteps / 16, [&, step = int64_t { 0 }]() mutable {
+        for (int i = 0; i < 16; ++i)
+            sink = sink + evaluateStepPerVoice(0.3f, 0.6f, densities, step++);
+    });
+    const double renderBarStatic = nanosecondsPer(numSteps / 16, [&, step = int64_t { 0 }]() mutable {
+        sink = sink + engine.renderSteps(step, 16, events.data(), static_cast<int>(events.size()));
+        step += 16;
+    });
+    report("16-step lookahead, X/Y static", perBarStatic, renderBarStatic, "bar");
+
+    // X moving every step: every render first rebuilds levels and masks (updateCache)
+    const double perStepMoving = nanosecondsPer(numSteps, [&, step = int64_t { 0 }]() mutable {
+        const float x = static_cast<float>(step % 1000) / 1000.0f;
+        sink = sink + evaluateStepPerVoice(x, 0.6f, densities, step++);
+    });
+    const double renderMoving = nanosecondsPer(numSteps, [&, step = int64_t { 0 }]() mutable {
+        engine.setX(static_cast<float>(step % 1000) / 1000.0f);
+        sink = sink + engine.renderSteps(step++, 1, events.data(), static_cast<int>(events.size()));
+    });
+    report("Pattern step, X moving, float", perStepMoving, renderMoving, "step");
+    
+    // As the processor ramps X: mid-ramp positions on the 8-bit grid
+    const double renderRamp = nanosecondsPer(numSteps, [&, step = int64_t { 0 }]() mutable {
+        engine.setX(std::round(static_cast<float>(step % 1000) / 1000.0f * 255.0f) / 255.0f);
+        sink = sink + engine.renderSteps(step++, 1, events.data(), static_cast<int>(events.size()));
+    });
+    report("Pattern step, X ramping, float", perStepMoving, renderRamp, "step");
+    engine.setInterpolationMode(GridsEngine::InterpolationMode::FixedPoint);
+    const double renderMovingFixed = nanosecondsPer(numSteps, [&, step = int64_t { 0 }]() mutable {
+        engine.setX(static_cast<float>(step % 1000) / 1000.0f);
+        sink = sink + engine.renderSteps(step++, 1, events.data(), static_cast<int>(events.size()));
+    });
+    report("Pattern step, X moving, fixed point", perStepMoving, renderMovingFixed, "step");
+}
+
+} // namespace
+
+int main()
+{
+    const juce::ScopedJuceInitialiser_GUI juceInitialiser;  // As a host would set JUCE up
+
+    std::printf("%-40s %16s %16s %8s\n", "", "before", "now", "speedup");
+    benchmarkScheduling();
+    benchmarkPattern();
+    return 0;
+}
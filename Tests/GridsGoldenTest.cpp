@@ -0,0 +1,84 @@
+#include <JuceHeader.h>
+#include "Grids/GridsEngine.h"
+#include "Grids/GridsInterpolation.h"
+#include "GridsGoldenVectors.h"
+
+#include <cstdio>
+
+/**
+ * Fixed-Point mode against the Grids firmware, level for level.
+ *
+ * GridsGoldenVectors.h is generated by generate_grids_golden.py, a
+ * transcription of the firmware's ReadDrumMap and U8Mix that shares no code
+ * with the plugin. For every corner and mid-cell X/Y it holds all 32 steps of
+ * all three instruments. The engine's levels, its accent masks (level > 192,
+ * as in the firmware), its trigger masks at a few densities (level above the
+ * inverted 8-bit density) and the per-byte readDrumMapFixedPoint all have to
+ * match it.
+ */
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char* what, int x, int y, int voice, int step) {
+    if (!condition && failures++ < 20)
+        std::printf("Mismatch (%s) at x %d y %d voice %d step %d\n", what, x, y, voice, step);
+}
+
+} // namespace
+
+int main() {
+    constexpr int kNumSteps = static_cast<int>(grids::kPatternLength);
+    constexpr uint8_t kDensities[] = { 32, 128, 200, 255 };
+
+    GridsEngine engine;
+    engine.setInterpolationMode(GridsEngine::InterpolationMode::FixedPoint);
+
+    for (size_t yi = 0; yi < GridsGolden::kCoordinates.size(); ++yi) {
+        for (size_t xi = 0; xi < GridsGolden::kCoordinates.size(); ++xi) {
+            const uint8_t x = GridsGolden::kCoordinates[xi];
+            const uint8_t y = GridsGolden::kCoordinates[yi];
+            const uint8_t* golden = GridsGolden::kLevels[yi][xi];
+
+            engine.setX(x / 255.0f);
+            engine.setY(y / 255.0f);
+
+            for (int voice = 0; voice < GridsEngine::kNumDrumVoices; ++voice) {
+                const auto levels = engine.getPattern(voice);
+                const uint32_t accents = engine.getAccentMask(voice);
+
+                for (int step = 0; step < kNumSteps; ++step) {
+                    const auto offset = static_cast<size_t>(voice * kNumSteps + step);
+                    expect(levels[static_cast<size_t>(step)] == golden[offset], "engine level", x, y, voice, step);
+                    expect(grids::readDrumMapFixedPoint(x, y, offset) == golden[offset], "readDrumMapFixedPoint",
+                           x, y, voice, step);
+                    expect(((accents >> step) & 1u) == (golden[offset] > 192 ? 1u : 0u), "accent", x, y, voice, step);
+                }
+            }
+
+            for (const auto density : kDensities) {
+                for (int voice = 0; voice < GridsEngine::kNumDrumVoices; ++voice)
+                    engine.setDensity(voice, density / 255.0f);
+
+                for (int voice = 0; voice < GridsEngine::kNumDrumVoices; ++voice) {
+                    const uint32_t triggers = engine.getTriggerMask(voice);
+                    for (int step = 0; step < kNumSteps; ++step) {
+                        const uint8_t level = golden[voice * kNumSteps + step];
+                        const bool expected = level > static_cast<uint8_t>(~density);
+                        expect(((triggers >> step) & 1u) == (expected ? 1u : 0u), "trigger", x, y, voice, step);
+                    }
+                }
+            }
+        }
+    }
+
+    if (failures > 0) {
+        std::printf("%d mismatches against the firmware golden vectors\n", failures);
+        return 1;
+    }
+
+    std::printf("Fixed-Point mode matches the firmware at %zu coordinates\n",
+                GridsGolden::kCoordinates.size() * GridsGolden::kCoordinates.size());
+    return 0;
+}
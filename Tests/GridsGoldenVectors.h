@@ -0,0 +1,682 @@
+#pragma once
+
+// Generated by generate_grids_golden.py from the Grids firmware's ReadDrumMap - do not edit
+
+#include <array>
+#include <cstdint>
+
+namespace GridsGolden {
+
+constexpr std::array<uint8_t, 9> kCoordinates { 0, 32, 64, 96, 128, 160, 192, 224, 255 };
+
+// kLevels[yi][xi][instrument * 32 + step] at x = kCoordinates[xi], y = kCoordinates[yi]
+constexpr uint8_t kLevels[9][9][96] = {
+    {
+        { // x 0, y 0
+            253,   0,   0,   0,   0,   0, 143,   0,   0,   0,   0,   0, 216,   0,   0,   0,
+             70,   0,  34,   0, 180,   0,   0,   0, 107,   0,   0,   0,  70,   0,   0,   0,
+             34,   0, 107,   0,   0,   0,   6,   0, 253,   0,   0,   0,   0,   0,  70,   0,
+              0,   0, 180,   0,   0,   0,  34,   0, 216,   0,   0,   0, 143,   0,   0,   0,
+            168,   0, 111,   0, 253,   0,  54,   0, 168,   0, 139,   0, 196,   0,  54,   0,
+            168,   0, 111,   0, 224,   0,  26,   0, 168,   0, 111,   0, 196,   0,  83,   0,
+        },
+        { // x 32, y 0
+            240,   0,  11,   0,  50,   0,  83,   0, 101,   0,  11,   0, 145,   0,   3,   0,
+            162,   0,  20,   0, 114,   0,  11,   0, 142,   0,  11,   0, 111,   0,  62,   0,
+             30,   0, 152,   0,  27,   0,  30,   0, 238,   0,  13,   0,  69,   0,  48,   0,
+             13,   0, 174,   0,  13,   0,  30,   0, 234,   0,  55,   0, 113,   0,  41,   0,
+            162,   0, 134,   0, 253,   0,  58,   0, 162,   0, 148,   0, 192,   0,  42,   0,
+            162,   0, 118,   0, 238,   0,  28,   0, 162,   0, 118,   0, 208,   0,  88,   0,
+        },
+        { // x 64, y 0
+            227,   0,  23,   0, 100,   0,  23,   0, 202,   0,  23,   0,  74,   0,   6,   0,
+            253,   0,   6,   0,  49,   0,  23,   0, 176,   0,  23,   0, 151,   0, 125,   0,
+             26,   0, 196,   0,  54,   0,  54,   0, 224,   0,  26,   0, 139,   0,  26,   0,
+             26,   0, 168,   0,  26,   0,  26,   0, 253,   0, 111,   0,  83,   0,  83,   0,
+            157,   0, 157,   0, 253,   0,  61,   0, 157,   0, 157,   0, 189,   0,  29,   0,
+            157,   0, 125,   0, 253,   0,  29,   0, 157,   0, 125,   0, 221,   0,  93,   0,
+        },
+        { // x 96, y 0
+            240,   0,  11,   0, 113,   0,  11,   0, 100,   0,  62,   0,  36,   0, 117,   0,
+            125,   0,  91,   0, 126,   0,  11,   0, 125,   0,  36,   0, 151,   0,  74,   0,
+             12,   0, 160,   0,  26,   0,  26,   0, 238,   0, 108,   0,  84,   0,  44,   0,
+             12,   0, 130,   0,  12,   0,  12,   0, 237,   0,  55,   0,  56,   0, 120,   0,
+            205,   0, 120,   0, 199,   0,  72,   0, 141,   0, 120,   0, 146,   0,  45,   0,
+            183,   0, 147,   0, 221,   0,  99,   0, 120,   0,  83,   0, 226,   0,  56,   0,
+        },
+        { // x 128, y 0
+            253,   0,   0,   0, 125,   0,   0,   0,   0,   0, 100,   0,   0,   0, 227,   0,
+              0,   0, 176,   0, 202,   0,   0,   0,  74,   0,  49,   0, 151,   0,  23,   0,
+              0,   0, 125,   0,   0,   0,   0,   0, 253,   0, 189,   0,  29,   0,  61,   0,
+              0,   0,  93,   0,   0,   0,   0,   0, 221,   0,   0,   0,  29,   0, 157,   0,
+            253,   0,  83,   0, 146,   0,  83,   0, 125,   0,  83,   0, 104,   0,  61,   0,
+            210,   0, 168,   0, 189,   0, 168,   0,  83,   0,  40,   0, 231,   0,  19,   0,
+        },
+        { // x 160, y 0
+            253,   0, 105,   0,  93,   0,   0,   0,  52,   0, 123,   0,  41,   0, 176,   0,
+             94,   0,  97,   0, 216,   0,   0,   0,  47,   0, 109,   0,  74,   0,  32,   0,
+              0,   0,  62,   0,  69,   0,  55,   0, 253,   0, 192,   0,  14,   0,  58,   0,
+              0,   0,  88,   0,  27,   0,  13,   0, 222,   0,  13,   0,  99,   0, 105,   0,
+            253,   0, 156,   0, 199,   0, 145,   0, 131,   0,  87,   0, 109,   0,  76,   0,
+            196,   0, 117,   0, 116,   0, 106,   0, 122,   0,  31,   0, 218,   0,  32,   0,
+        },
+        { // x 192, y 0
+            253,   0, 210,   0,  61,   0,   0,   0, 104,   0, 146,   0,  83,   0, 125,   0,
+            189,   0,  19,   0, 231,   0,   0,   0,  19,   0, 168,   0,   0,   0,  40,   0,
+              0,   0,   0,   0, 139,   0, 111,   0, 253,   0, 196,   0,   0,   0,  54,   0,
+              0,   0,  83,   0,  54,   0,  26,   0, 224,   0,  26,   0, 168,   0,  54,   0,
+            253,   0, 229,   0, 253,   0, 206,   0, 137,   0,  90,   0, 113,   0,  90,   0,
+            183,   0,  67,   0,  44,   0,  44,   0, 160,   0,  21,   0, 206,   0,  44,   0,
+        },
+        { // x 224, y 0
+            253,   0, 119,   0,  61,   0,  30,   0, 115,   0, 119,   0, 136,   0,  93,   0,
+            205,   0,  24,   0, 194,   0,  30,   0,  24,   0, 114,   0,  46,   0,  35,   0,
+              3,   0,   0,   0, 116,   0,  86,   0, 253,   0,  97,   0,  62,   0,  26,   0,
+              3,   0,  41,   0, 106,   0,  44,   0, 238,   0, 124,   0, 178,   0,  42,   0,
+            163,   0, 126,   0, 253,   0, 165,   0, 144,   0,  70,   0, 158,   0,  95,   0,
+            128,   0,  58,   0, 136,   0,  85,   0, 155,   0,  35,   0, 191,   0,  72,   0,
+        },
+        { // x 255, y 0
+            253,   0,  32,   0,  61,   0,  61,   0, 125,   0,  94,   0, 188,   0,  62,   0,
+            220,   0,  29,   0, 158,   0,  61,   0,  29,   0,  63,   0,  92,   0,  30,   0,
+              6,   0,   0,   0,  94,   0,  62,   0, 253,   0,   1,   0, 124,   0,   0,   0,
+              6,   0,   0,   0, 156,   0,  61,   0, 252,   0, 218,   0, 189,   0,  30,   0,
+             76,   0,  26,   0, 253,   0, 126,   0, 151,   0,  50,   0, 201,   0, 100,   0,
+             75,   0,  50,   0, 224,   0, 124,   0, 151,   0,  49,   0, 176,   0,  99,   0,
+        },
+    },
+    {
+        { // x 0, y 32
+            253,   0,  25,   0,  12,   0, 108,   0,   0,   0,   0,   0, 158,   0,   0,   0,
+            136,   0, 131,   0,  89,   0,  88,   0,  53,   0,  76,   0,  98,   0,   3,   0,
+            105,   0, 116,   0,  76,   0, 104,   0, 253,   0,   0,   0,  12,   0,  72,   0,
+             50,   0, 114,   0,   0,   0,  17,   0, 221,   0,  12,   0,  83,   0, 101,   0,
+            172,   0, 106,   0, 253,   0,  64,   0, 146,   0, 106,   0, 211,   0,  64,   0,
+            159,   0, 106,   0, 238,   0,  25,   0, 146,   0,  80,   0, 199,   0,  66,   0,
+        },
+        { // x 32, y 32
+            246,   0,  18,   0,  86,   0,  60,   0,  58,   0,   7,   0, 129,   0,   1,   0,
+            154,   0,  66,   0,  96,   0,  49,   0,  94,   0,  59,   0, 134,   0,  32,   0,
+             71,   0, 158,   0,  51,   0,  91,   0, 245,   0,  38,   0,  42,   0,  87,   0,
+             38,   0, 156,   0,   6,   0,  34,   0, 224,   0,  71,   0,  75,   0,  77,   0,
+            188,   0, 148,   0, 253,   0, 111,   0, 161,   0,  99,   0, 187,   0,  53,   0,
+            160,   0,  98,   0, 203,   0,  27,   0, 154,   0,  78,   0, 182,   0,  70,   0,
+        },
+        { // x 64, y 32
+            240,   0,  11,   0, 161,   0,  11,   0, 115,   0,  15,   0, 100,   0,   3,   0,
+            173,   0,   3,   0, 103,   0,  11,   0, 134,   0,  42,   0, 170,   0,  62,   0,
+             38,   0, 199,   0,  27,   0,  77,   0, 238,   0,  76,   0,  72,   0, 101,   0,
+             25,   0, 197,   0,  13,   0,  50,   0, 227,   0, 131,   0,  66,   0,  53,   0,
+            205,   0, 190,   0, 253,   0, 157,   0, 176,   0,  91,   0, 164,   0,  42,   0,
+            162,   0,  90,   0, 168,   0,  28,   0, 162,   0,  76,   0, 166,   0,  74,   0,
+        },
+        { // x 96, y 32
+            238,   0,   5,   0, 127,   0,   5,   0,  81,   0,  32,   0, 105,   0,  66,   0,
+            149,   0,  45,   0, 142,   0,   5,   0, 117,   0,  41,   0, 170,   0,  44,   0,
+             18,   0, 130,   0,  40,   0,  38,   0, 236,   0,  85,   0,  89,   0,  84,   0,
+             14,   0, 130,   0,  42,   0,  33,   0, 232,   0,  67,   0,  86,   0,  84,   0,
+            229,   0, 134,   0, 216,   0, 108,   0, 173,   0,  66,   0, 143,   0,  36,   0,
+            196,   0,  95,   0, 176,   0,  65,   0, 147,   0,  48,   0, 167,   0,  41,   0,
+        },
+        { // x 128, y 32
+            237,   0,   0,   0,  93,   0,   0,   0,  47,   0,  50,   0, 111,   0, 128,   0,
+            127,   0,  87,   0, 179,   0,   0,   0, 100,   0,  39,   0, 170,   0,  26,   0,
+              0,   0,  62,   0,  54,   0,   0,   0, 234,   0,  94,   0, 105,   0,  66,   0,
+              3,   0,  64,   0,  72,   0,  17,   0, 237,   0,   3,   0, 105,   0, 113,   0,
+            253,   0,  77,   0, 181,   0,  59,   0, 171,   0,  41,   0, 124,   0,  30,   0,
+            231,   0, 101,   0, 184,   0, 101,   0, 132,   0,  20,   0, 169,   0,   9,   0,
+        },
+        { // x 160, y 32
+            245,   0,  52,   0, 116,   0,   0,   0,  58,   0,  61,   0, 130,   0,  95,   0,
+            155,   0,  75,   0, 210,   0,   0,   0,  55,   0,  62,   0, 120,   0,  41,   0,
+             39,   0,  31,   0,  69,   0,  59,   0, 243,   0, 103,   0,  52,   0,  70,   0,
+              3,   0,  52,   0,  97,   0,  23,   0, 237,   0,  16,   0, 150,   0,  86,   0,
+            253,   0, 103,   0, 168,   0,  88,   0, 142,   0,  51,   0, 106,   0,  69,   0,
+            200,   0,  75,   0, 118,   0,  69,   0, 161,   0,  71,   0, 183,   0,  63,   0,
+        },
+        { // x 192, y 32
+            253,   0, 104,   0, 139,   0,   0,   0,  69,   0,  72,   0, 150,   0,  62,   0,
+            184,   0,  63,   0, 242,   0,   0,   0,   9,   0,  83,   0,  72,   0,  55,   0,
+             79,   0,   0,   0,  84,   0, 118,   0, 253,   0, 112,   0,   0,   0,  74,   0,
+              3,   0,  41,   0, 122,   0,  28,   0, 238,   0,  28,   0, 194,   0,  58,   0,
+            253,   0, 129,   0, 157,   0, 117,   0, 115,   0,  60,   0,  87,   0, 108,   0,
+            170,   0,  48,   0,  53,   0,  37,   0, 190,   0, 121,   0, 197,   0, 117,   0,
+        },
+        { // x 224, y 32
+            245,   0,  66,   0,  91,   0,  50,   0,  68,   0,  61,   0, 185,   0,  48,   0,
+            175,   0,  46,   0, 209,   0,  36,   0,  26,   0, 106,   0, 101,   0,  42,   0,
+             42,   0,  23,   0,  67,   0,  76,   0, 253,   0,  71,   0,  38,   0,  92,   0,
+              5,   0,  28,   0, 148,   0,  31,   0, 245,   0, 101,   0, 175,   0,  76,   0,
+            173,   0,  82,   0, 205,   0, 135,   0, 129,   0,  48,   0, 146,   0, 107,   0,
+            160,   0,  53,   0, 146,   0,  90,   0, 167,   0, 101,   0, 200,   0, 106,   0,
+        },
+        { // x 255, y 32
+            238,   0,  29,   0,  45,   0,  99,   0,  66,   0,  50,   0, 220,   0,  34,   0,
+            166,   0,  28,   0, 177,   0,  72,   0,  42,   0, 128,   0, 130,   0,  29,   0,
+              7,   0,  46,   0,  51,   0,  35,   0, 253,   0,  31,   0,  77,   0, 110,   0,
+              6,   0,  15,   0, 172,   0,  34,   0, 252,   0, 171,   0, 157,   0,  93,   0,
+             96,   0,  35,   0, 251,   0, 154,   0, 143,   0,  36,   0, 202,   0, 107,   0,
+            152,   0,  59,   0, 237,   0, 141,   0, 144,   0,  82,   0, 202,   0,  95,   0,
+        },
+    },
+    {
+        { // x 0, y 64
+            253,   0,  49,   0,  23,   0,  74,   0,   0,   0,   0,   0, 100,   0,   0,   0,
+            202,   0, 227,   0,   0,   0, 176,   0,   0,   0, 151,   0, 125,   0,   6,   0,
+            176,   0, 125,   0, 151,   0, 202,   0, 253,   0,   0,   0,  23,   0,  74,   0,
+            100,   0,  49,   0,   0,   0,   0,   0, 227,   0,  23,   0,  23,   0, 202,   0,
+            176,   0, 100,   0, 253,   0,  74,   0, 125,   0,  74,   0, 227,   0,  74,   0,
+            151,   0, 100,   0, 253,   0,  23,   0, 125,   0,  49,   0, 202,   0,  49,   0,
+        },
+        { // x 32, y 64
+            253,   0,  24,   0, 122,   0,  36,   0,  14,   0,   3,   0, 113,   0,   0,   0,
+            147,   0, 112,   0,  78,   0,  87,   0,  46,   0, 106,   0, 157,   0,   2,   0,
+            112,   0, 164,   0,  74,   0, 151,   0, 253,   0,  62,   0,  15,   0, 125,   0,
+             62,   0, 138,   0,   0,   0,  37,   0, 214,   0,  87,   0,  36,   0, 112,   0,
+            214,   0, 162,   0, 253,   0, 164,   0, 161,   0,  50,   0, 183,   0,  64,   0,
+            159,   0,  77,   0, 168,   0,  25,   0, 147,   0,  38,   0, 156,   0,  52,   0,
+        },
+        { // x 64, y 64
+            253,   0,   0,   0, 221,   0,   0,   0,  29,   0,   6,   0, 125,   0,   0,   0,
+             93,   0,   0,   0, 157,   0,   0,   0,  93,   0,  61,   0, 189,   0,   0,   0,
+             49,   0, 202,   0,   0,   0, 100,   0, 253,   0, 125,   0,   6,   0, 176,   0,
+             23,   0, 227,   0,   0,   0,  74,   0, 202,   0, 151,   0,  49,   0,  23,   0,
+            253,   0, 224,   0, 253,   0, 253,   0, 196,   0,  26,   0, 139,   0,  54,   0,
+            168,   0,  54,   0,  83,   0,  26,   0, 168,   0,  26,   0, 111,   0,  54,   0,
+        },
+        { // x 96, y 64
+            237,   0,   0,   0, 141,   0,   0,   0,  61,   0,   2,   0, 173,   0,  14,   0,
+            173,   0,   0,   0, 157,   0,   0,   0, 109,   0,  45,   0, 189,   0,  14,   0,
+             24,   0, 100,   0,  53,   0,  49,   0, 234,   0,  62,   0,  93,   0, 123,   0,
+             15,   0, 130,   0,  71,   0,  54,   0, 227,   0,  78,   0, 115,   0,  47,   0,
+            253,   0, 147,   0, 234,   0, 143,   0, 206,   0,  12,   0, 141,   0,  26,   0,
+            210,   0,  44,   0, 132,   0,  30,   0, 174,   0,  12,   0, 109,   0,  26,   0,
+        },
+        { // x 128, y 64
+            221,   0,   0,   0,  61,   0,   0,   0,  93,   0,   0,   0, 221,   0,  29,   0,
+            253,   0,   0,   0, 157,   0,   0,   0, 125,   0,  29,   0, 189,   0,  29,   0,
+              0,   0,   0,   0, 107,   0,   0,   0, 216,   0,   0,   0, 180,   0,  70,   0,
+              6,   0,  34,   0, 143,   0,  34,   0, 253,   0,   6,   0, 180,   0,  70,   0,
+            253,   0,  70,   0, 216,   0,  34,   0, 216,   0,   0,   0, 143,   0,   0,   0,
+            253,   0,  34,   0, 180,   0,  34,   0, 180,   0,   0,   0, 107,   0,   0,   0,
+        },
+        { // x 160, y 64
+            237,   0,   0,   0, 139,   0,   0,   0,  64,   0,   0,   0, 218,   0,  14,   0,
+            216,   0,  53,   0, 205,   0,   0,   0,  62,   0,  14,   0, 166,   0,  50,   0,
+             78,   0,   0,   0,  68,   0,  62,   0, 234,   0,  14,   0,  89,   0,  82,   0,
+              6,   0,  16,   0, 166,   0,  32,   0, 253,   0,  18,   0, 200,   0,  66,   0,
+            253,   0,  50,   0, 138,   0,  32,   0, 154,   0,  14,   0, 102,   0,  62,   0,
+            205,   0,  32,   0, 120,   0,  32,   0, 200,   0, 110,   0, 148,   0,  94,   0,
+        },
+        { // x 192, y 64
+            253,   0,   0,   0, 216,   0,   0,   0,  34,   0,   0,   0, 216,   0,   0,   0,
+            180,   0, 107,   0, 253,   0,   0,   0,   0,   0,   0,   0, 143,   0,  70,   0,
+            157,   0,   0,   0,  29,   0, 125,   0, 253,   0,  29,   0,   0,   0,  93,   0,
+              6,   0,   0,   0, 189,   0,  29,   0, 253,   0,  29,   0, 221,   0,  61,   0,
+            253,   0,  29,   0,  61,   0,  29,   0,  93,   0,  29,   0,  61,   0, 125,   0,
+            157,   0,  29,   0,  61,   0,  29,   0, 221,   0, 221,   0, 189,   0, 189,   0,
+        },
+        { // x 224, y 64
+            238,   0,  13,   0, 121,   0,  69,   0,  20,   0,   3,   0, 234,   0,   3,   0,
+            145,   0,  67,   0, 224,   0,  41,   0,  27,   0,  98,   0, 155,   0,  48,   0,
+             81,   0,  46,   0,  18,   0,  66,   0, 253,   0,  45,   0,  14,   0, 157,   0,
+              6,   0,  14,   0, 189,   0,  18,   0, 253,   0,  77,   0, 173,   0, 109,   0,
+            183,   0,  37,   0, 157,   0, 106,   0, 115,   0,  25,   0, 134,   0, 119,   0,
+            193,   0,  48,   0, 157,   0,  95,   0, 179,   0, 167,   0, 209,   0, 139,   0,
+        },
+        { // x 255, y 64
+            224,   0,  26,   0,  29,   0, 137,   0,   7,   0,   6,   0, 252,   0,   6,   0,
+            112,   0,  27,   0, 196,   0,  82,   0,  54,   0, 193,   0, 168,   0,  27,   0,
+              8,   0,  92,   0,   7,   0,   8,   0, 253,   0,  61,   0,  29,   0, 219,   0,
+              6,   0,  29,   0, 189,   0,   7,   0, 253,   0, 124,   0, 126,   0, 156,   0,
+            115,   0,  44,   0, 250,   0, 181,   0, 136,   0,  22,   0, 204,   0, 113,   0,
+            228,   0,  67,   0, 250,   0, 158,   0, 138,   0, 114,   0, 228,   0,  91,   0,
+        },
+    },
+    {
+        { // x 0, y 96
+            198,   0,  24,   0,  11,   0,  91,   0,   0,   0,   0,   0, 177,   0,  54,   0,
+            136,   0, 221,   0,   0,   0,  87,   0,  17,   0,  75,   0, 153,   0,   3,   0,
+             87,   0, 125,   0, 154,   0, 163,   0, 205,   0,  95,   0, 122,   0,  68,   0,
+            177,   0,  71,   0,  15,   0,  47,   0, 128,   0,  15,   0,  42,   0, 104,   0,
+            214,   0,  50,   0, 198,   0,  37,   0, 153,   0,  91,   0, 167,   0,  91,   0,
+            183,   0,  50,   0, 161,   0,  11,   0, 153,   0,  60,   0, 191,   0,  42,   0,
+        },
+        { // x 32, y 96
+            225,   0,  12,   0,  61,   0,  45,   0,   7,   0,   1,   0, 119,   0,  27,   0,
+            154,   0, 110,   0,  93,   0,  61,   9,  31,   0,  98,   0, 123,   0,  37,  27,
+             56,   0, 144,   0,  76,   0, 117,   0, 218,   0,  78,  53,  62,   0, 131,   0,
+             94,   0,  92,   0,  18,   0,  42,   0, 177,   0,  45,   0,  76,  42,  89,  21,
+            206,   0, 107,  27, 216,  27,  99,   0, 161,   0,  70,   0, 172,   0,  86,   0,
+            178,   0,  65,   0, 165,   0,  30,   0, 163,  27,  45,  27, 186,  27,  62,   0,
+        },
+        { // x 64, y 96
+            253,   0,   0,   0, 110,   0,   0,   0,  14,   0,   3,   0,  62,   0,   0,   0,
+            173,   0,   0,   0, 186,   0,  35,  17,  46,   0, 121,   0,  94,   0,  72,  54,
+             24,   0, 163,   0,   0,   0,  70,   0, 231,   0,  62, 105,   3,   0, 193,   0,
+             11,   0, 113,   0,  20,   0,  37,   0, 227,   0,  75,   0, 109,  84,  74,  42,
+            198,   0, 165,  54, 234,  54, 161,   0, 169,   0,  48,   0, 177,   0,  81,   0,
+            174,   0,  81,   0, 168,   0,  48,   0, 174,  54,  30,  54, 182,  54,  81,   0,
+        },
+        { // x 96, y 96
+            245,   0,   0,   0, 133,   0,  47,   0,  30,   0,   1,   0, 109,   0,  22,   0,
+            157,   0,   0,   0, 187,   0,  73,   8,  54,   0,  69,   0, 133,   0,  74,  27,
+             12,   0, 102,   0,  40,   0,  41,   0, 232,   0,  38,  52,  46,   0, 170,   0,
+              7,   0, 107,   0,  59,   0,  55,   0, 225,   0,  39,   0, 127,  42,  90,  21,
+            225,   0, 110,  27, 228,  27, 104,   0, 191,   0,  45,   0, 171,   0,  66,   0,
+            197,   0,  54,   0, 171,   0,  34,   0, 174,  27,  46,  27, 154,  27,  77,   0,
+        },
+        { // x 128, y 96
+            237,   0,   0,   0, 157,   0,  95,   0,  46,   0,   0,   0, 157,   0,  45,   0,
+            141,   0,   0,   0, 189,   0, 111,   0,  62,   0,  18,   0, 173,   0,  77,   0,
+              0,   0,  42,   0,  81,   0,  13,   0, 234,   0,  13,   0,  89,   0, 147,   0,
+              3,   0, 101,   0,  98,   0,  73,   0, 224,   0,   3,   0, 145,   0, 105,   0,
+            253,   0,  55,   0, 223,   0,  48,   0, 213,   0,  42,   0, 166,   0,  52,   0,
+            221,   0,  27,   0, 174,   0,  20,   0, 174,   0,  63,   0, 127,   0,  73,   0,
+        },
+        { // x 160, y 96
+            245,   0,   0,   0, 132,   0,  63,   0,  79,   0,  23,   0, 139,   0,  78,   0,
+            178,   0,  42,   0, 181,   0,  71,   0,  70,   0,   8,   0, 121,   0,  88,   0,
+             57,   0,  21,   0,  47,   0,  37,   0, 243,   0,  13,   0,  44,   0,  97,   0,
+             21,   0,  68,   0, 105,   0,  46,   0, 229,   0,  54,   0, 163,   0,  95,   0,
+            253,   0,  75,   0, 184,   0,  72,   0, 186,   0,  56,   0, 150,   0,  92,   0,
+            195,   0,  44,   0, 148,   0,  29,   0, 182,   0, 103,   0, 150,   0,  89,   0,
+        },
+        { // x 192, y 96
+            253,   0,   0,   0, 107,   0,  31,   0, 112,   0,  47,   0, 122,   0, 111,   0,
+            216,   0,  84,   0, 173,   0,  31,   0,  79,   0,   0,   0,  71,   0,  98,   0,
+            113,   0,   0,   0,  14,   0,  62,   0, 253,   0,  14,   0,   0,   0,  46,   0,
+             38,   0,  35,   0, 111,   0,  18,   0, 234,   0, 105,   0, 182,   0,  84,   0,
+            253,   0,  95,   0, 145,   0,  95,   0, 161,   0,  71,   0, 134,   0, 131,   0,
+            170,   0,  60,   0, 122,   0,  37,   0, 190,   0, 144,   0, 174,   0, 105,   0,
+        },
+        { // x 224, y 96
+            245,   0,   6,   0,  73,   0,  50,   0,  57,   0,  25,   0, 149,   0,  56,   0,
+            186,   0,  49,   0, 173,   0,  36,   0,  52,   0,  49,   0,  89,   0,  55,   0,
+             58,   0,  23,   0,  11,   0,  42,   0, 253,   0,  22,   0,  52,   0,  80,   0,
+             20,   0,  24,   0, 120,   0,  38,   0, 216,   0,  83,   0, 185,   0, 136,   0,
+            207,   0,  60,   0, 177,   0,  93,   0, 146,   0,  41,   0, 139,   0,  95,   0,
+            205,   0,  48,   0, 166,   0,  58,   0, 160,   0, 100,   0, 154,   0,  76,   0,
+        },
+        { // x 255, y 96
+            238,   0,  13,   0,  39,   0,  68,   0,   4,   0,   3,   0, 175,   0,   4,   0,
+            157,   0,  13,   0, 173,   0,  41,   0,  27,   0,  96,   0, 108,   0,  14,   0,
+              4,   0,  46,   0,   7,   0,  21,   0, 253,   0,  30,   0, 104,   0, 112,   0,
+              3,   0,  14,   0, 129,   0,  57,   0, 198,   0,  63,   0, 189,   0, 185,   0,
+            163,   0,  26,   0, 209,   0,  90,   0, 131,   0,  11,   0, 144,   0,  61,   0,
+            240,   0,  37,   0, 209,   0,  78,   0, 131,   0,  57,   0, 135,   0,  49,   0,
+        },
+    },
+    {
+        { // x 0, y 128
+            143,   0,   0,   0,   0,   0, 107,   0,   0,   0,   0,   0, 253,   0, 107,   0,
+             70,   0, 216,   0,   0,   0,   0,   0,  34,   0,   0,   0, 180,   0,   0,   0,
+              0,   0, 125,   0, 157,   0, 125,   0, 157,   0, 189,   0, 221,   0,  61,   0,
+            253,   0,  93,   0,  29,   0,  93,   0,  29,   0,   6,   0,  61,   0,   6,   0,
+            253,   0,   0,   0, 143,   0,   0,   0, 180,   0, 107,   0, 107,   0, 107,   0,
+            216,   0,   0,   0,  70,   0,   0,   0, 180,   0,  70,   0, 180,   0,  34,   0,
+        },
+        { // x 32, y 128
+            198,   0,   0,   0,   0,   0,  53,   0,   0,   0,   0,   0, 125,   0,  53,   0,
+            162,   0, 107,   0, 108,   0,  35,  17,  16,   0,  90,   0,  89,   0,  71,  53,
+              0,   0, 125,   0,  77,   0,  83,   0, 183,   0,  93, 105, 109,   0, 136,   0,
+            125,   0,  46,   0,  35,   0,  46,   0, 141,   0,   2,   0, 115,  84,  66,  41,
+            198,   0,  53,  53, 179,  53,  35,   0, 161,   0,  89,   0, 162,   0, 107,   0,
+            198,   0,  53,   0, 162,   0,  35,   0, 180,  53,  52,  53, 216,  53,  71,   0,
+        },
+        { // x 64, y 128
+            253,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+            253,   0,   0,   0, 216,   0,  70,  34,   0,   0, 180,   0,   0,   0, 143, 107,
+              0,   0, 125,   0,   0,   0,  40,   0, 210,   0,   0, 210,   0,   0, 210,   0,
+              0,   0,   0,   0,  40,   0,   0,   0, 253,   0,   0,   0, 168, 168, 125,  83,
+            143,   0, 107, 107, 216, 107,  70,   0, 143,   0,  70,   0, 216,   0, 107,   0,
+            180,   0, 107,   0, 253,   0,  70,   0, 180, 107,  34, 107, 253, 107, 107,   0,
+        },
+        { // x 96, y 128
+            253,   0,   0,   0, 126,   0,  94,   0,   0,   0,   0,   0,  46,   0,  30,   0,
+            141,   0,   0,   0, 218,   0, 146,  16,   0,   0,  93,   0,  78,   0, 134,  53,
+              0,   0, 104,   0,  27,   0,  33,   0, 231,   0,  13, 104,   0,   0, 217,   0,
+              0,   0,  84,   0,  47,   0,  55,   0, 224,   0,   0,   0, 139,  83, 132,  41,
+            198,   0,  74,  53, 223,  53,  66,   0, 176,   0,  77,   0, 202,   0, 106,   0,
+            184,   0,  63,   0, 210,   0,  38,   0, 174,  53,  80,  53, 199,  53, 127,   0,
+        },
+        { // x 128, y 128
+            253,   0,   0,   0, 253,   0, 189,   0,   0,   0,   0,   0,  93,   0,  61,   0,
+             29,   0,   0,   0, 221,   0, 221,   0,   0,   0,   6,   0, 157,   0, 125,   0,
+              0,   0,  83,   0,  54,   0,  26,   0, 253,   0,  26,   0,   0,   0, 224,   0,
+              0,   0, 168,   0,  54,   0, 111,   0, 196,   0,   0,   0, 111,   0, 139,   0,
+            253,   0,  40,   0, 231,   0,  61,   0, 210,   0,  83,   0, 189,   0, 104,   0,
+            189,   0,  19,   0, 168,   0,   6,   0, 168,   0, 125,   0, 146,   0, 146,   0,
+        },
+        { // x 160, y 128
+            253,   0,   0,   0, 125,   0, 125,   0,  94,   0,  46,   0,  61,   0, 141,   0,
+            141,   0,  30,   0, 157,   0, 141,   0,  78,   0,   2,   0,  77,   0, 125,   0,
+             35,   0,  41,   0,  26,   0,  12,   0, 253,   0,  12,   0,   0,   0, 111,   0,
+             35,   0, 119,   0,  44,   0,  59,   0, 206,   0,  90,   0, 127,   0, 123,   0,
+            253,   0, 100,   0, 230,   0, 111,   0, 219,   0,  98,   0, 197,   0, 121,   0,
+            186,   0,  55,   0, 175,   0,  25,   0, 164,   0,  96,   0, 153,   0,  83,   0,
+        },
+        { // x 192, y 128
+            253,   0,   0,   0,   0,   0,  61,   0, 189,   0,  93,   0,  29,   0, 221,   0,
+            253,   0,  61,   0,  93,   0,  61,   0, 157,   0,   0,   0,   0,   0, 125,   0,
+             70,   0,   0,   0,   0,   0,   0,   0, 253,   0,   0,   0,   0,   0,   0,   0,
+             70,   0,  70,   0,  34,   0,   6,   0, 216,   0, 180,   0, 143,   0, 107,   0,
+            253,   0, 160,   0, 229,   0, 160,   0, 229,   0, 113,   0, 206,   0, 137,   0,
+            183,   0,  90,   0, 183,   0,  44,   0, 160,   0,  67,   0, 160,   0,  21,   0,
+        },
+        { // x 224, y 128
+            253,   0,   0,   0,  24,   0,  30,   0,  93,   0,  46,   0,  65,   0, 109,   0,
+            227,   0,  30,   0, 122,   0,  30,   0,  77,   0,   0,   0,  24,   0,  62,   0,
+             34,   0,   0,   0,   3,   0,  17,   0, 253,   0,   0,   0,  90,   0,   3,   0,
+             34,   0,  34,   0,  52,   0,  57,   0, 179,   0,  89,   0, 198,   0, 162,   0,
+            231,   0,  83,   0, 198,   0,  79,   0, 177,   0,  56,   0, 144,   0,  71,   0,
+            218,   0,  48,   0, 175,   0,  21,   0, 142,   0,  33,   0, 100,   0,  14,   0,
+        },
+        { // x 255, y 128
+            253,   0,   0,   0,  49,   0,   0,   0,   1,   0,   0,   0,  99,   0,   1,   0,
+            202,   0,   0,   0, 150,   0,   0,   0,   0,   0,   0,   0,  49,   0,   0,   0,
+              0,   0,   0,   0,   6,   0,  34,   0, 253,   0,   0,   0, 178,   0,   6,   0,
+              0,   0,   0,   0,  70,   0, 106,   0, 144,   0,   1,   0, 251,   0, 214,   0,
+            210,   0,   8,   0, 169,   0,   0,   0, 126,   0,   0,   0,  85,   0,   8,   0,
+            252,   0,   7,   0, 168,   0,   0,   0, 125,   0,   0,   0,  42,   0,   7,   0,
+        },
+    },
+    {
+        { // x 0, y 160
+            198,   0,   0,   0,   0,   0,  53,   0,  17,   0,   0,   0, 216,   0,  53,   0,
+            143,   0, 107,   0,   0,   0,   0,   0,  52,   0,   0,   0, 161,   0,  54,   0,
+             17,   0,  80,   0,  78,   0,  62,   0, 205,   0,  94,   0, 200,   0,  30,   0,
+            126,   0,  46,   0,  14,   0,  46,  54, 123,   0,   3,   0, 102,   0,  38,  35,
+            253,   0,  13,   0, 183,   0,  27,   0, 188,   0,  53,   0,  53,   0,  67,  13,
+            192,   0,   0,   0, 105,   0,   0,   0, 145,   0,  35,   0, 131,  42,  59,  42,
+        },
+        { // x 32, y 160
+            225,   0,   0,   0,   0,   0,  50,   0,   8,   0,  31,   0, 107,   0,  26,   0,
+            190,   0,  77,   0,  69,   0,  25,   8,  73,   0,  45,   0, 120,   0,  62,  26,
+              8,   0,  79,   0, 102,   0,  41,   0, 154,   0,  70,  52, 155,   0,  67,   0,
+             62,   0,  38,   0,  65,   0,  23,  27, 124,   0,   1,   0, 133,  42,  82,  38,
+            197,   0,  40,  26, 152,  26,  38,   0, 157,   0,  46,   0,  82,   0,  62,   6,
+            204,   0,  26,   0, 171,   0,  17,   0, 167,  26,  40,  26, 171,  47,  77,  21,
+        },
+        { // x 64, y 160
+            253,   0,   0,   0,   0,   0,  47,   0,   0,   0,  63,   0,   0,   0,   0,   0,
+            237,   0,  47,   0, 138,   0,  50,  17,  95,   0,  89,   0,  79,   0,  71,  53,
+              0,   0,  77,   0, 127,   0,  20,   0, 104,   0,  47, 104, 111,   0, 104,   0,
+              0,   0,  31,   0, 115,   0,   0,   0, 126,   0,   0,   0, 162,  83, 125,  41,
+            141,   0,  67,  53, 121,  53,  48,   0, 127,   0,  38,   0, 111,   0,  57,   0,
+            216,   0,  53,   0, 238,   0,  35,   0, 188,  53,  44,  53, 210,  53,  95,   0,
+        },
+        { // x 96, y 160
+            253,   0,   0,   0,  65,   0,  70,   0,  45,   0,  31,   0,  41,   0,  15,   0,
+            179,   0,  23,   0, 133,   0,  80,   8,  83,   0,  46,   0, 105,   0,  66,  26,
+              0,   0,  72,   6,  95,   6,  22,   0, 153,   0,  30,  52,  87,  25, 152,   0,
+             51,   0,  57,   0,  70,   0,  91,   0, 111,   0,  25,   0, 165,  41, 116,  20,
+            161,   0,  43,  26, 153,  26,  61,   0, 115,   0,  40,   0, 144,   0,  54,   0,
+            168,   7,  95,   0, 160,   0,  19,   0, 185,  26,  53,  26, 197,  26,  84,   0,
+        },
+        { // x 128, y 160
+            253,   0,   0,   0, 129,   0,  94,   0,  90,   0,   0,   0,  82,   0,  30,   0,
+            123,   0,   0,   0, 127,   0, 110,   0,  72,   0,   3,   0, 132,   0,  62,   0,
+              0,   0,  66,  12,  64,  12,  25,   0, 202,   0,  13,   0,  63,  50, 200,   0,
+            101,   0,  83,   0,  27,   0, 182,   0,  97,   0,  50,   0, 169,   0, 106,   0,
+            182,   0,  20,   0, 185,   0,  72,   0, 104,   0,  41,   0, 178,   0,  52,   0,
+            121,  13, 136,   0,  83,   0,   3,   0, 182,   0,  62,   0, 185,   0,  72,   0,
+        },
+        { // x 160, y 160
+            253,   0,   2,   0,  71,   0,  69,   0, 141,   0,  37,   0,  62,   0,  91,   0,
+            187,   0,  36,   0, 115,   0,  98,   0, 131,   0,  36,   0, 108,   0,  97,   0,
+             17,   0,  33,   6,  31,   6,  12,   0, 227,   0,   6,   0,  63,  25,  99,   0,
+             68,   0,  59,   0,  22,   0,  92,   0, 118,   0,  70,   0, 168,   0,  80,   0,
+            217,   0,  50,   0, 213,   0, 108,   0, 109,   0,  70,   0, 140,   0, 113,   0,
+            106,   6, 143,   0,  97,   0,  55,   0, 130,   0,  79,   0, 132,   0,  41,   0,
+        },
+        { // x 192, y 160
+            253,   0,   3,   0,  13,   0,  44,   0, 192,   0,  74,   0,  42,   0, 152,   0,
+            253,   0,  72,   0, 102,   0,  86,   0, 190,   0,  70,   0,  84,   0, 132,   0,
+             35,   0,   0,   0,   0,   0,   0,   0, 253,   0,   0,   0,  63,   0,   0,   0,
+             35,   0,  35,   0,  17,   0,   3,   0, 138,   0,  89,   0, 166,   0,  53,   0,
+            253,   0,  79,   0, 241,   0, 142,   0, 114,   0,  98,   0, 102,   0, 173,   0,
+             91,   0, 150,   0, 111,   0, 106,   0,  79,   0,  96,   0,  79,   0,  10,   0,
+        },
+        { // x 224, y 160
+            253,   0,   1,   0,  18,   0,  76,   0, 141,   0,  36,   0,  46,   0, 111,   0,
+            212,   0,  45,   0,  89,   0,  70,   0, 121,   0,  34,   0,  72,   0,  74,   0,
+             17,   0,   0,   0,  28,   0,  10,   0, 207,   0,   0,   0, 140,   0,  47,   0,
+             17,   0,  17,   0,  62,   0,  30,   0, 113,   0,  46,   0, 200,   0, 126,   0,
+            242,   0,  41,   0, 161,   0, 127,   0, 109,   0,  49,   0, 106,   0,  88,   0,
+            108,   0,  76,   0, 139,   0,  66,   0, 120,   0,  48,   0,  78,   0,  14,   0,
+        },
+        { // x 255, y 160
+            253,   0,   0,   0,  24,   0, 107,   0,  91,   0,   0,   0,  49,   0,  72,   0,
+            173,   0,  18,   0,  75,   0,  54,   0,  54,   0,   0,   0,  60,   0,  18,   0,
+              0,   0,   0,   0,  56,   0,  20,   0, 162,   0,   0,   0, 214,   0,  92,   0,
+              0,   0,   0,   0, 106,   0,  56,   0,  89,   0,   4,   0, 233,   0, 196,   0,
+            231,   0,   4,   0,  85,   0, 111,   0, 104,   0,   0,   0, 111,   0,   5,   0,
+            125,   0,   4,   0, 167,   0,  28,   0, 159,   0,   0,   0,  76,   0,  17,   0,
+        },
+    },
+    {
+        { // x 0, y 192
+            253,   0,   0,   0,   0,   0,   0,   0,  34,   0,   0,   0, 180,   0,   0,   0,
+            216,   0,   0,   0,   0,   0,   0,   0,  70,   0,   0,   0, 143,   0, 107,   0,
+             34,   0,  34,   0,   0,   0,   0,   0, 253,   0,   0,   0, 180,   0,   0,   0,
+              0,   0,   0,   0,   0,   0,   0, 107, 216,   0,   0,   0, 143,   0,  70,  70,
+            253,   0,  26,   0, 224,   0,  54,   0, 196,   0,   0,   0,   0,   0,  26,  26,
+            168,   0,   0,   0, 139,   0,   0,   0, 111,   0,   0,   0,  83,  83,  83,  83,
+        },
+        { // x 32, y 192
+            253,   0,   0,   0,   0,   0,  46,   0,  16,   0,  62,   0,  89,   0,   0,   0,
+            218,   0,  46,   0,  30,   0,  14,   0, 130,   0,   0,   0, 150,   0,  53,   0,
+             16,   0,  32,   0, 126,   0,   0,   0, 125,   0,  46,   0, 200,   0,   0,   0,
+              0,   0,  30,   0,  94,   0,   0,  53, 107,   0,   0,   0, 150,   0,  98,  34,
+            196,   0,  26,   0, 125,   0,  40,   0, 153,   0,   3,   0,   3,   0,  16,  12,
+            210,   0,   0,   0, 181,   0,   0,   0, 154,   0,  27,   0, 126,  41,  83,  41,
+        },
+        { // x 64, y 192
+            253,   0,   0,   0,   0,   0,  93,   0,   0,   0, 125,   0,   0,   0,   0,   0,
+            221,   0,  93,   0,  61,   0,  29,   0, 189,   0,   0,   0, 157,   0,   0,   0,
+              0,   0,  29,   0, 253,   0,   0,   0,   0,   0,  93,   0, 221,   0,   0,   0,
+              0,   0,  61,   0, 189,   0,   0,   0,   0,   0,   0,   0, 157,   0, 125,   0,
+            139,   0,  26,   0,  26,   0,  26,   0, 111,   0,   6,   0,   6,   0,   6,   0,
+            253,   0,   0,   0, 224,   0,   0,   0, 196,   0,  54,   0, 168,   0,  83,   0,
+        },
+        { // x 96, y 192
+            253,   0,   0,   0,   3,   0,  46,   0,  90,   0,  62,   0,  35,   0,   0,   0,
+            218,   0,  46,   0,  48,   0,  14,   0, 166,   0,   0,   0, 132,   0,   0,   0,
+              0,   0,  39,  11, 163,  11,  11,   0,  75,   0,  46,   0, 173,  50,  88,   0,
+            101,   0,  30,   0,  93,   0, 126,   0,   0,   0,  50,   0, 192,   0, 100,   0,
+            125,   0,  12,   0,  83,   0,  55,   0,  55,   0,   2,   0,  87,   0,   2,   0,
+            153,  13, 126,   0, 111,   0,   0,   0, 196,   0,  26,   0, 196,   0,  41,   0,
+        },
+        { // x 128, y 192
+            253,   0,   0,   0,   6,   0,   0,   0, 180,   0,   0,   0,  70,   0,   0,   0,
+            216,   0,   0,   0,  34,   0,   0,   0, 143,   0,   0,   0, 107,   0,   0,   0,
+              0,   0,  49,  23,  74,  23,  23,   0, 151,   0,   0,   0, 125, 100, 176,   0,
+            202,   0,   0,   0,   0,   0, 253,   0,   0,   0, 100,   0, 227,   0,  74,   0,
+            111,   0,   0,   0, 139,   0,  83,   0,   0,   0,   0,   0, 168,   0,   0,   0,
+             54,  26, 253,   0,   0,   0,   0,   0, 196,   0,   0,   0, 224,   0,   0,   0,
+        },
+        { // x 160, y 192
+            253,   0,   3,   0,  16,   0,  13,   0, 188,   0,  27,   0,  62,   0,  41,   0,
+            234,   0,  41,   0,  73,   0,  55,   0, 183,   0,  69,   0, 138,   0,  69,   0,
+              0,   0,  24,  11,  36,  11,  11,   0, 202,   0,   0,   0, 125,  49,  87,   0,
+            100,   0,   0,   0,   0,   0, 125,   0,  30,   0,  49,   0, 208,   0,  36,   0,
+            182,   0,   0,   0, 196,   0, 104,   0,   0,   0,  41,   0,  83,   0, 105,   0,
+             26,  12, 231,   0,  20,   0,  84,   0,  97,   0,  62,   0, 111,   0,   0,   0,
+        },
+        { // x 192, y 192
+            253,   0,   6,   0,  26,   0,  26,   0, 196,   0,  54,   0,  54,   0,  83,   0,
+            253,   0,  83,   0, 111,   0, 111,   0, 224,   0, 139,   0, 168,   0, 139,   0,
+              0,   0,   0,   0,   0,   0,   0,   0, 253,   0,   0,   0, 125,   0,   0,   0,
+              0,   0,   0,   0,   0,   0,   0,   0,  61,   0,   0,   0, 189,   0,   0,   0,
+            253,   0,   0,   0, 253,   0, 125,   0,   0,   0,  83,   0,   0,   0, 210,   0,
+              0,   0, 210,   0,  40,   0, 168,   0,   0,   0, 125,   0,   0,   0,   0,   0,
+        },
+        { // x 224, y 192
+            253,   0,   2,   0,  12,   0, 121,   0, 188,   0,  26,   0,  26,   0, 113,   0,
+            198,   0,  59,   0,  55,   0, 109,   0, 165,   0,  68,   0, 119,   0,  86,   0,
+              0,   0,   0,   0,  53,   0,   3,   0, 161,   0,   0,   0, 189,   0,  90,   0,
+              0,   0,   0,   0,  71,   0,   3,   0,  48,   0,   3,   0, 202,   0,  90,   0,
+            253,   0,   0,   0, 125,   0, 175,   0,  41,   0,  41,   0,  69,   0, 104,   0,
+              0,   0, 104,   0, 104,   0, 111,   0,  98,   0,  62,   0,  55,   0,  13,   0,
+        },
+        { // x 255, y 192
+            253,   0,   0,   0,   0,   0, 213,   0, 180,   0,   0,   0,   0,   0, 142,   0,
+            144,   0,  35,   0,   0,   0, 107,   0, 108,   0,   0,   0,  71,   0,  36,   0,
+              0,   0,   0,   0, 106,   0,   6,   0,  72,   0,   0,   0, 251,   0, 178,   0,
+              0,   0,   0,   0, 141,   0,   6,   0,  35,   0,   6,   0, 215,   0, 178,   0,
+            253,   0,   0,   0,   1,   0, 222,   0,  82,   0,   0,   0, 137,   0,   1,   0,
+              0,   0,   1,   0, 166,   0,  56,   0, 193,   0,   0,   0, 110,   0,  26,   0,
+        },
+    },
+    {
+        { // x 0, y 224
+            253,   0,   0,   0,  56,   0,   0,   0, 115,   0,  27,   0, 131,   0,  13,   0,
+            234,   0,   0,   0, 112,   0,   0,   0, 119,   0,   0,   0, 141,   0,  53,   0,
+             17,   0,  17,   0,   0,   0,   0,   0, 253,   0,  72,   0, 143,   0, 108,   0,
+             17,   0,  90,   0,  35,   0,  35,  53, 234,   0,   0,   0,  71,   0,  89,  35,
+            143,   0,  30,   0, 183,   0,  27,   0, 133,   0,  35,   0,  90,   0,  13,  13,
+            119,   0,  35,   0, 177,   0,   0,   0, 109,   0,  54,   0, 168,  41,  41,  41,
+        },
+        { // x 32, y 224
+            253,   0,   0,   0,  82,   0,  23,   0,  93,   0,  44,   0,  74,   0,   6,   0,
+            226,   0,  23,   0,  80,   0,   7,   0, 152,   0,  18,   0, 109,   0,  53,   0,
+              8,   0,  16,   0,  65,   0,   0,   0, 189,   0,  80,   0, 179,   0,  64,   0,
+              8,   0,  60,   0,  66,   0,  17,  26, 138,   0,  42,   0, 106,   0,  86,  17,
+            133,   0,  49,   0, 162,   0,  20,   0, 111,   0,  37,   0, 101,   0,   8,   6,
+            158,   0,  63,   0, 207,   0,   0,   0, 112,   0,  49,   0, 180,  20,  43,  20,
+        },
+        { // x 64, y 224
+            253,   0,   0,   0, 108,   0,  46,   0,  72,   0,  62,   0,  17,   0,   0,   0,
+            218,   0,  46,   0,  48,   0,  14,   0, 184,   0,  35,   0,  78,   0,  54,   0,
+              0,   0,  14,   0, 129,   0,   0,   0, 127,   0,  88,   0, 215,   0,  20,   0,
+              0,   0,  30,   0,  97,   0,   0,   0,  42,   0,  84,   0, 141,   0,  83,   0,
+            123,   0,  67,   0, 140,   0,  13,   0,  91,   0,  38,   0, 111,   0,   3,   0,
+            198,   0,  90,   0, 238,   0,   0,   0, 115,   0,  44,   0, 192,   0,  45,   0,
+        },
+        { // x 96, y 224
+            253,   0,   0,   0,  66,   0,  23,   0, 133,   0,  31,   0,  28,   0,  53,   0,
+            205,   0,  23,   0,  54,   0,   7,   0, 180,   0,  19,   0,  97,   0,  29,   0,
+             63,   0,  40,   5,  82,   5,   5,   0, 157,   0,  65,   0, 138,  25, 103,   0,
+             50,   0,  50,   0,  62,   0,  63,   0,  63,   0,  74,   0, 127,   0,  88,   0,
+            117,   0,  47,   0, 168,   0,  27,   0,  66,   0,  32,   0, 154,   0,   1,   0,
+            111,   6, 150,   0, 118,   0,  35,   0, 113,   0,  28,   0, 201,   0,  29,   0,
+        },
+        { // x 128, y 224
+            253,   0,   0,   0,  23,   0,   0,   0, 195,   0,   0,   0,  38,   0, 105,   0,
+            192,   0,   0,   0,  59,   0,   0,   0, 176,   0,   3,   0, 116,   0,   3,   0,
+            127,   0,  66,  11,  37,  11,  11,   0, 187,   0,  42,   0,  62,  50, 186,   0,
+            100,   0,  70,   0,  27,   0, 126,   0,  84,   0,  63,   0, 113,   0,  93,   0,
+            111,   0,  27,   0, 196,   0,  41,   0,  42,   0,  27,   0, 196,   0,   0,   0,
+             27,  13, 210,   0,   0,   0,  70,   0, 111,   0,  13,   0, 210,   0,  13,   0,
+        },
+        { // x 160, y 224
+            253,   0,   1,   0,  75,   0,   6,   0, 197,   0,  64,   0,  32,   0,  92,   0,
+            203,   0,  58,   0,  70,   0,  72,   0, 188,   0,  68,   0, 125,  12,  49,   6,
+             63,   0,  33,   5,  18,   5,   5,   7, 156,   0,  21,   0, 126,  24,  92,   7,
+             50,   0,  36,   0,  13,   0, 110,  39,  88,  23,  55,   0, 159,   0,  61,   0,
+            182,   0,  77,   0, 211,  51, 103,  51,  21,   0,  47,  12, 110,  12,  52,   0,
+             64,   6, 208,   0,  48,  38, 115,  38,  93,   0,  37,   0, 130,  25,  32,  25,
+        },
+        { // x 192, y 224
+            253,   0,   3,   0, 127,   0,  13,   0, 199,   0, 128,   0,  27,   0,  79,   0,
+            214,   0, 117,   0,  80,   0, 144,   0, 200,   0, 132,   0, 134,  25,  94,  12,
+              0,   0,   0,   0,   0,   0,   0,  15, 126,   0,   0,   0, 189,   0,   0,  15,
+              0,   0,   3,   0,   0,   0,  95,  79,  93,  47,  47,   0, 205,   0,  31,   0,
+            253,   0, 127,   0, 227, 101, 164, 101,   0,   0,  66,  25,  25,  25, 104,   0,
+            101,   0, 206,   0,  96,  76, 159,  76,  76,   0,  62,   0,  50,  50,  50,  50,
+        },
+        { // x 224, y 224
+            231,   0,   1,   0,  62,  63,  60,   0, 193,   0,  63,   0,  13,   7,  75,   0,
+            177,   0,  67,   0,  40,  56,  98,   0, 140,   0,  65,  28,  84,  33,  55,   6,
+             63,   0,   0,   0,  26,  28,   1,   7, 101,   0,   0,   0, 157,  56,  45,   7,
+             35,   0,   1,   2,  35,  42,  62,  53, 105,  23,  25,  14, 155,  35,  67,   0,
+            253,   0,  63,   0, 113,  98, 137,  50,  60,   0,  33,  12,  47,  68,  52,   0,
+             74,   0, 102,   0,  89,  53,  93,  37, 118,   0,  31,   0,  52,  33,  31,  25,
+        },
+        { // x 255, y 224
+            211,   0,   0,   0,   1, 125, 106,   0, 188,   0,   1,   0,   0,  13,  70,   0,
+            141,   0,  18,   0,   0, 111,  54,   0,  82,   0,   0,  55,  36,  42,  18,   0,
+            125,   0,   0,   0,  53,  55,   3,   0,  77,   0,   0,   0, 126, 111,  88,   0,
+             69,   0,   0,   3,  70,  83,  31,  28, 115,   0,   3,  27, 108,  69, 102,   0,
+            253,   0,   1,   0,   1,  95, 111,   1, 119,   0,   0,   0,  68, 110,   0,   0,
+             47,   0,   1,   0,  83,  31,  28,   0, 159,   0,   0,   0,  55,  15,  13,   0,
+        },
+    },
+    {
+        { // x 0, y 255
+            253,   0,   0,   0, 110,   0,   0,   0, 194,   0,  54,   0,  84,   0,  26,   0,
+            252,   0,   0,   0, 221,   0,   0,   0, 167,   0,   0,   0, 139,   0,   1,   0,
+              0,   0,   0,   0,   0,   0,   0,   0, 253,   0, 141,   0, 108,   0, 213,   0,
+             34,   0, 178,   0,  69,   0,  69,   1, 252,   0,   0,   0,   1,   0, 107,   0,
+             37,   0,  34,   0, 144,   0,   0,   0,  72,   0,  69,   0, 178,   0,   0,   0,
+             71,   0,  69,   0, 215,   0,   0,   0, 107,   0, 106,   0, 251,   0,   0,   0,
+        },
+        { // x 32, y 255
+            253,   0,   0,   0, 162,   0,   0,   0, 167,   0,  27,   0,  60,   0,  12,   0,
+            233,   0,   0,   0, 128,   0,   0,   0, 173,   0,  35,   0,  69,   0,  53,   0,
+              0,   0,   0,   0,   5,   0,   0,   0, 251,   0, 112,   0, 159,   0, 126,   0,
+             16,   0,  88,   0,  39,   0,  34,   0, 167,   0,  83,   0,  63,   0,  74,   0,
+             73,   0,  71,   0, 197,   0,   0,   0,  71,   0,  69,   0, 195,   0,   0,   0,
+            108,   0, 124,   0, 233,   0,   0,   0,  72,   0,  71,   0, 232,   0,   4,   0,
+        },
+        { // x 64, y 255
+            253,   0,   0,   0, 213,   0,   1,   0, 141,   0,   1,   0,  34,   0,   0,   0,
+            216,   0,   1,   0,  35,   0,   0,   0, 180,   0,  69,   0,   1,   0, 106,   0,
+              0,   0,   0,   0,   9,   0,   0,   0, 250,   0,  83,   0, 210,   0,  40,   0,
+              0,   0,   0,   0,   9,   0,   0,   0,  82,   0, 166,   0, 125,   0,  41,   0,
+            107,   0, 106,   0, 250,   0,   0,   0,  71,   0,  69,   0, 213,   0,   0,   0,
+            144,   0, 178,   0, 252,   0,   0,   0,  36,   0,  35,   0, 215,   0,   7,   0,
+        },
+        { // x 96, y 255
+            253,   0,   0,   0, 127,   0,   0,   0, 175,   0,   0,   0,  21,   0, 104,   0,
+            192,   0,   0,   0,  59,   0,   0,   0, 194,   0,  38,   0,  63,   0,  57,   0,
+            125,   0,  41,   0,   4,   0,   0,   0, 236,   0,  83,   0, 105,   0, 118,   0,
+              1,   0,  69,   0,  31,   0,   1,   0, 125,   0,  97,   0,  64,   0,  76,   0,
+            109,   0,  80,   0, 251,   0,   0,   0,  77,   0,  62,   0, 218,   0,   0,   0,
+             71,   0, 173,   0, 125,   0,  68,   0,  32,   0,  30,   0, 206,   0,  17,   0,
+        },
+        { // x 128, y 255
+            253,   0,   0,   0,  40,   0,   0,   0, 209,   0,   0,   0,   7,   0, 207,   0,
+            168,   0,   0,   0,  83,   0,   0,   0, 209,   0,   6,   0, 125,   0,   6,   0,
+            250,   0,  83,   0,   0,   0,   0,   0, 223,   0,  82,   0,   1,   1, 195,   0,
+              2,   0, 137,   0,  54,   0,   2,   0, 166,   0,  27,   0,   2,   0, 111,   0,
+            111,   0,  54,   0, 251,   0,   0,   0,  82,   0,  54,   0, 223,   0,   0,   0,
+              0,   0, 169,   0,   0,   0, 137,   0,  28,   0,  26,   0, 196,   0,  26,   0,
+        },
+        { // x 160, y 255
+            253,   0,   0,   0, 133,   0,   0,   0, 205,   0, 100,   0,   3,   0, 141,   0,
+            173,   0,  75,   0,  66,   0,  88,   0, 193,   0,  66,   0, 113,  24,  29,  11,
+            124,   0,  41,   0,   0,   0,   0,  14, 112,   0,  41,   0, 126,   0,  97,  14,
+              1,   0,  71,   0,  26,   0,  94,  77, 145,  46,  60,   0, 111,   0,  86,   0,
+            182,   0, 152,   0, 226, 100, 101, 100,  41,   0,  52,  24, 135,  24,   1,   0,
+            100,   0, 185,   0,  75,  74, 144,  74,  89,   0,  13,   0, 147,  50,  63,  50,
+        },
+        { // x 192, y 255
+            253,   0,   0,   0, 224,   0,   0,   0, 202,   0, 200,   0,   0,   0,  74,   0,
+            177,   0, 150,   0,  50,   0, 175,   0, 176,   0, 125,   0, 101,  49,  50,  23,
+              0,   0,   0,   0,   0,   0,   0,  29,   2,   0,   0,   0, 251,   0,   0,  29,
+              0,   0,   6,   0,   0,   0, 187, 155, 124,  92,  92,   0, 220,   0,  61,   0,
+            253,   0, 250,   0, 202, 199, 201, 199,   0,   0,  50,  49,  49,  49,   2,   0,
+            199,   0, 202,   0, 150, 149, 151, 149, 149,   0,   1,   0,  99,  99,  99,  99,
+        },
+        { // x 224, y 255
+            210,   0,   0,   0, 111, 125,   1,   0, 199,   0,  99,   0,   0,  13,  37,   0,
+            157,   0,  74,   0,  25, 111,  87,   0, 116,   0,  62,  55,  50,  65,  25,  11,
+            125,   0,   0,   0,   0,  55,   0,  14,  43,   0,   0,   0, 126, 111,   1,  14,
+             68,   0,   2,   3,   0,  83, 120, 104, 160,  46,  46,  27, 110,  68,  45,   0,
+            253,   0, 124,   0, 100, 192, 101,  99,  78,   0,  25,  24,  25, 133,   1,   0,
+            145,   0, 100,   0,  75, 105,  75,  73, 137,   0,   0,   0,  49,  64,  49,  49,
+        },
+        { // x 255, y 255
+            170,   0,   0,   0,   1, 247,   2,   0, 196,   0,   1,   0,   0,  26,   1,   0,
+            139,   0,   1,   0,   0, 218,   3,   0,  57,   0,   0, 109,   1,  82,   0,   0,
+            247,   0,   0,   0,   1, 109,   0,   0,  82,   0,   0,   0,   4, 218,   2,   0,
+            135,   0,   0,   6,   1, 164,  56,  55, 193,   0,   1,  54,   4, 135,  29,   0,
+            253,   0,   1,   0,   1, 187,   4,   1, 154,   0,   0,   0,   1, 216,   0,   0,
+             93,   0,   1,   0,   2,  62,   1,   0, 126,   0,   0,   0,   2,  30,   1,   0,
+        },
+    },
+};
+
+} // namespace GridsGolden
@@ -0,0 +1,139 @@
+#include "Grids/GridsInterpolation.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+
+/**
+ * blendNodes against blendNodesScalar, byte for byte.
+ *
+ * Covers every X/Y weight pair on each cell the engine can read, and every
+ * weight on every ordered pair of nodes, so the SSE2 or NEON path compiled
+ * into this build has to agree with the reference everywhere. A length that
+ * is not a multiple of 16 checks the hand-off to the scalar tail.
+ *
+ * blendNodesFloat is checked against the per-byte float loop GridsEngine used
+ * before it, across a fine X/Y sweep of the whole grid, so Float mode keeps
+ * producing the same levels.
+ */
+
+namespace {
+
+int failures = 0;
+
+void expectSame(const uint8_t* n00, const uint8_t* n01, const uint8_t* n10, const uint8_t* n11,
+                uint8_t fx, uint8_t fy, size_t length, const char* what) {
+    std::array<uint8_t, grids::kNodeSize> vector {};
+    std::array<uint8_t, grids::kNodeSize> scalar {};
+    grids::blendNodes(n00, n01, n10, n11, fx, fy, vector.data(), length);
+    grids::blendNodesScalar(n00, n01, n10, n11, fx, fy, scalar.data(), length);
+
+    if (std::memcmp(vector.data(), scalar.data(), length) != 0 && failures++ < 10)
+        std::printf("Mismatch (%s) at fx %d fy %d length %zu\n", what, fx, fy, length);
+}
+
+const uint8_t* node(int index) { return grids::node_table[index]->data(); }
+
+// GridsEngine::rebuildLevels' float loop before blendNodesFloat, unchanged
+void previousFloatLevels(float x, float y, uint8_t* levels) {
+    float scaledX = x * 4.0f;
+    float scaledY = y * 4.0f;
+    int x0 = static_cast<int>(scaledX);
+    int y0 = static_cast<int>(scaledY);
+    int x1 = std::min(x0 + 1, 4);
+    int y1 = std::min(y0 + 1, 4);
+    float fx = scaledX - x0;
+    float fy = scaledY - y0;
+
+    const auto& n00 = *grids::node_table[y0 * 5 + x0];
+    const auto& n01 = *grids::node_table[y0 * 5 + x1];
+    const auto& n10 = *grids::node_table[y1 * 5 + x0];
+    const auto& n11 = *grids::node_table[y1 * 5 + x1];
+
+    for (size_t offset = 0; offset < grids::kNodeSize; ++offset) {
+        float v0 = n00[offset] * (1.0f - fx) + n01[offset] * fx;
+        float v1 = n10[offset] * (1.0f - fx) + n11[offset] * fx;
+        float result = v0 * (1.0f - fy) + v1 * fy;
+        levels[offset] = static_cast<uint8_t>(result);
+    }
+}
+
+void expectSameAsPreviousFloat(float x, float y) {
+    const float scaledX = x * 4.0f;
+    const float scaledY = y * 4.0f;
+    const int x0 = static_cast<int>(scaledX);
+    const int y0 = static_cast<int>(scaledY);
+    const int x1 = std::min(x0 + 1, 4);
+    const int y1 = std::min(y0 + 1, 4);
+
+    std::array<uint8_t, grids::kNodeSize> vector {};
+    std::array<uint8_t, grids::kNodeSize> previous {};
+    grids::blendNodesFloat(node(y0 * 5 + x0), node(y0 * 5 + x1), node(y1 * 5 + x0), node(y1 * 5 + x1),
+                           scaledX - x0, scaledY - y0, vector.data());
+    previousFloatLevels(x, y, previous.data());
+
+    if (vector != previous && failures++ < 10)
+        std::printf("Float mismatch at x %.6f y %.6f\n", x, y);
+}
+
+} // namespace
+
+int main() {
+#if GRIDS_INTERPOLATION_SSE2
+    std::printf("Testing the SSE2 path\n");
+#elif GRIDS_INTERPOLATION_NEON
+    std::printf("Testing the NEON path\n");
+#else
+    std::printf("No vector unit: testing the scalar path against itself\n");
+#endif
+
+    // Every weight pair on the 4x4 cells the fixed-point path reads
+    for (int cellY = 0; cellY < 4; ++cellY)
+        for (int cellX = 0; cellX < 4; ++cellX) {
+            const int cell = cellY * 5 + cellX;
+            for (int fx = 0; fx < 256; ++fx)
+                for (int fy = 0; fy < 256; ++fy)
+                    expectSame(node(cell), node(cell + 1), node(cell + 5), node(cell + 6),
+                               static_cast<uint8_t>(fx), static_cast<uint8_t>(fy), grids::kNodeSize, "cell");
+        }
+
+    // Every weight across every ordered pair of nodes, in both axes
+    for (int a = 0; a < static_cast<int>(grids::kNumNodes); ++a)
+        for (int b = 0; b < static_cast<int>(grids::kNumNodes); ++b)
+            for (int weight = 0; weight < 256; ++weight) {
+                const auto w = static_cast<uint8_t>(weight);
+                expectSame(node(a), node(b), node(a), node(b), w, 0, grids::kNodeSize, "pair in x");
+                expectSame(node(a), node(a), node(b), node(b), 0, w, grids::kNodeSize, "pair in y");
+                expectSame(node(a), node(b), node(b), node(a), w, static_cast<uint8_t>(255 - w),
+                           grids::kNodeSize, "pair crossed");
+            }
+
+    // Vector body plus scalar tail
+    for (size_t length = 0; length <= grids::kNodeSize; ++length)
+        expectSame(node(0), node(6), node(18), node(24), 200, 57, length, "tail");
+
+    // The float path across the grid, including every node and the far edges
+    constexpr int kFloatSteps = 1024;
+    for (int yi = 0; yi <= kFloatSteps; ++yi)
+        for (int xi = 0; xi <= kFloatSteps; ++xi)
+            expectSameAsPreviousFloat(static_cast<float>(xi) / kFloatSteps, static_cast<float>(yi) / kFloatSteps);
+
+    // Float vector body plus scalar tail
+    for (size_t length = 0; length <= grids::kNodeSize; ++length) {
+        std::array<uint8_t, grids::kNodeSize> vector {};
+        std::array<uint8_t, grids::kNodeSize> scalar {};
+        grids::blendNodesFloat(node(0), node(6), node(18), node(24), 0.37f, 0.81f, vector.data(), length);
+        grids::blendNodesFloatScalar(node(0), node(6), node(18), node(24), 0.37f, 0.81f, scalar.data(), length);
+        if (std::memcmp(vector.data(), scalar.data(), length) != 0 && failures++ < 10)
+            std::printf("Float mismatch (tail) at length %zu\n", length);
+    }
+
+    if (failures > 0) {
+        std::printf("%d mismatches\n", failures);
+        return 1;
+    }
+
+    std::printf("blendNodes matches blendNodesScalar, blendNodesFloat matches the previous float loop\n");
+    return 0;
+}
@@ -0,0 +1,226 @@
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+#include "Utils/AllocationTrap.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+/**
+ * Drives processBlock with the allocation trap armed.
+ *
+ * Plays the processor through a scripted host session - several block sizes,
+ * tempo changes, loops, stops, count-ins, pattern resets from the parameter,
+ * CCs (learned and not) and note-ons, parameter sweeps, Euclidean mode, and
+ * prepareToPlay called again mid-session - and fails if anything inside processBlock
+ * reached operator new. Note-ons in every block go through the velocity
+ * table, so this is also the allocation check for velocity generation. The
+ * host's MidiBuffer starts out default-constructed, so the output path can't
+ * lean on capacity the host happened to reserve.
+ *
+ * Debug builds with ENABLE_ALLOCATION_TRAP count through the plugin's own
+ * asserting operator new. In every other configuration this file replaces
+ * operator new with one that counts while a trap is armed, so the test runs
+ * in any build.
+ */
+
+#if ! GRIDDY_ALLOCATION_TRAP
+namespace {
+
+void* allocate(std::size_t size)
+{
+    if (ScopedAllocationTrap::isArmed())
+        ++ScopedAllocationTrap::caughtAllocations();
+
+    if (auto* ptr = std::malloc(size > 0 ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+} // namespace
+
+void* operator new(std::size_t size)   { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void operator delete(void* ptr) noexcept                { std::free(ptr); }
+void operator delete[](void* ptr) noexcept              { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept   { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+#endif
+
+namespace {
+
+class ScriptedPlayHead : public juce::AudioPlayHead
+{
+public:
+    juce::Optional<PositionInfo> getPosition() const override { return position; }
+
+    PositionInfo position;
+};
+
+class Session
+{
+public:
+    Session()
+    {
+        processor.setPlayHead(&playHead);
+        processor.setTelemetryActive(true);  // As if an editor were open
+        playHead.position.setTimeSignature(juce::AudioPlayHead::TimeSignature {});
+    }
+
+    void prepare(double sampleRate, int maxBlockSize)
+    {
+        processor.prepareToPlay(sampleRate, maxBlockSize);
+        buffer.setSize(2, maxBlockSize);
+        this->sampleRate = sampleRate;
+    }
+
+    void setParameter(const juce::String& id, float normalisedValue)
+    {
+        for (auto* parameter : processor.getParameters())
+            if (auto* withId = dynamic_cast<juce::AudioProcessorParameterWithID*>(parameter))
+                if (withId->getParameterID() == id)
+                    withId->setValueNotifyingHost(normalisedValue);
+    }
+
+    // Assigns a CC to a parameter as MIDI learn would
+    void learn(int controller, const juce::String& id)
+    {
+        for (auto* parameter : processor.getParameters())
+            if (auto* withId = dynamic_cast<juce::AudioProcessorParameterWithID*>(parameter))
+                if (withId->getParameterID() == id)
+                    processor.getMidiLearn().assign(controller, parameter->getParameterIndex());
+    }
+
+    void clearLearned() { processor.getMidiLearn().clearAll(); }
+
+    // Runs blocks at a tempo, moving the transport unless it is stopped
+    void run(const char* scenario, int numBlocks, int blockSize, double bpm, bool playing = true)
+    {
+        const int before = caught();
+
+        for (int block = 0; block < numBlocks; ++block) {
+            playHead.position.setBpm(bpm);
+            playHead.position.setIsPlaying(playing);
+            playHead.position.setPpqPosition(ppq);
+
+            // Incoming CCs and note-ons, added outside the trap like a host would
+            midi.clear();
+            if (block % 3 == 0)
+                midi.addEvent(juce::MidiMessage::controllerEvent(1, 1, block % 128), blockSize / 2);
+            if (block % 7 == 0)
+                midi.addEvent(juce::MidiMessage::noteOn(1, 36, static_cast<juce::uint8>(100)), blockSize / 3);
+
+            buffer.setSize(2, blockSize, false, false, true);
+            processor.processBlock(buffer, midi);
+
+            // The editor's timer drains the telemetry between blocks
+            TelemetryEvent event;
+            while (processor.getTelemetry().pop(event)) {}
+
+            if (playing)
+                ppq += blockSize * bpm / (60.0 * sampleRate);
+        }
+
+        const int allocations = caught() - before;
+        std::printf("%-36s %s\n", scenario, allocations == 0 ? "ok" : "ALLOCATED");
+        if (allocations != 0)
+            ++failures;
+    }
+
+    double ppq = 0.0;
+    int failures = 0;
+
+private:
+    static int caught() { return ScopedAllocationTrap::caughtAllocations().load(); }
+
+    GridsAudioProcessor processor;
+    ScriptedPlayHead playHead;
+    juce::AudioBuffer<float> buffer;
+    juce::MidiBuffer midi;
+    double sampleRate = 44100.0;
+};
+
+} // namespace
+
+int main()
+{
+    const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    Session session;
+
+    session.prepare(48000.0, 2048);
+    session.setParameter("density_1_bd", 0.8f);
+    session.setParameter("density_2_sd", 0.6f);
+    session.setParameter("density_3_hh", 0.9f);
+    session.run("steady 120 bpm, 512", 400, 512, 120.0);
+    session.run("small blocks at 174 bpm", 400, 64, 174.0);
+    session.run("odd block size, 2048 max", 200, 333, 97.0);
+    session.run("full 2048 blocks", 100, 2048, 140.0);
+
+    for (int change = 0; change < 40; ++change)
+        session.run("tempo change", 5, 256, 60.0 + change * 5.0);
+
+    session.ppq = 0.0;
+    session.run("loop back to the start", 50, 512, 120.0);
+    session.run("transport stopped", 50, 512, 120.0, false);
+    session.run("restart", 50, 512, 120.0);
+
+    session.ppq = -4.0;
+    session.run("count-in", 100, 512, 120.0);
+
+    for (int sweep = 0; sweep <= 20; ++sweep) {
+        session.setParameter("x", sweep / 20.0f);
+        session.setParameter("y", 1.0f - sweep / 20.0f);
+        session.setParameter("chaos", sweep / 40.0f);
+        session.run("pattern and chaos sweep", 4, 512, 120.0);
+    }
+
+    for (int sweep = 0; sweep <= 20; ++sweep) {
+        session.setParameter("velocity_1_bd", sweep / 20.0f);
+        session.setParameter("velocity_2_sd", 1.0f - sweep / 20.0f);
+        session.setParameter("velocity_3_hh", sweep / 40.0f);
+        session.run("velocity sweep", 4, 512, 120.0);
+    }
+
+    for (int press = 0; press < 10; ++press) {
+        session.setParameter("reset_mode", press % 2 == 0 ? 1.0f : 0.0f);
+        session.setParameter("reset", 1.0f);
+        session.run("reset parameter", 3, 512, 120.0);
+        session.setParameter("reset", 0.0f);
+        session.run("reset parameter", 3, 512, 120.0);
+    }
+
+    session.setParameter("note_reset", 1.0f);
+    session.run("note reset", 100, 512, 120.0);
+    session.setParameter("note_reset", 0.0f);
+
+    session.setParameter("note_fill", 1.0f);
+    session.run("note fill", 100, 512, 120.0);
+    session.setParameter("note_fill", 0.0f);
+
+    // The CC every third block sends now moves X on the audio thread
+    session.learn(1, "x");
+    session.run("learned CC", 100, 512, 120.0);
+    session.clearLearned();
+
+    session.setParameter("gate_mode", 0.0f);
+    session.run("gate mode off", 100, 512, 120.0);
+    session.setParameter("gate_mode", 1.0f);
+
+    session.setParameter("euclidean_mode", 1.0f);
+    session.run("euclidean mode", 200, 512, 120.0);
+    session.setParameter("euclidean_mode", 0.0f);
+
+    // A host resetting the processor and changing its block size mid-session
+    session.prepare(44100.0, 1024);
+    session.run("after prepareToPlay again", 200, 1024, 120.0);
+    session.run("after prepareToPlay, smaller blocks", 200, 128, 150.0);
+
+    if (session.failures > 0) {
+        std::printf("%d scenarios allocated inside processBlock\n", session.failures);
+        return 1;
+    }
+
+    std::printf("processBlock did not allocate\n");
+    return 0;
+}
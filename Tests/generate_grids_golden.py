@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+Writes GridsGoldenVectors.h: reference levels for GridsEngine's Fixed-Point
+mode, computed independently of the plugin's C++.
+
+The arithmetic is transcribed from the Mutable Instruments Grids firmware
+(grids/pattern_generator.cc, avrlib/op.h):
+
+    uint8_t U8Mix(uint8_t a, uint8_t b, uint8_t balance) {
+      Word sum;
+      sum.value = U8U8Mul(a, 255 - balance);
+      sum.value += U8U8Mul(b, balance);
+      return sum.bytes[1];
+    }
+
+    uint8_t PatternGenerator::ReadDrumMap(uint8_t step, uint8_t instrument,
+                                          uint8_t x, uint8_t y) {
+      uint8_t i = x >> 6;
+      uint8_t j = y >> 6;
+      const prog_uint8_t* a_map = drum_map[i][j];
+      const prog_uint8_t* b_map = drum_map[i + 1][j];
+      const prog_uint8_t* c_map = drum_map[i][j + 1];
+      const prog_uint8_t* d_map = drum_map[i + 1][j + 1];
+      uint8_t offset = (instrument * kStepsPerPattern) + step;
+      uint8_t a = pgm_read_byte(a_map + offset);
+      uint8_t b = pgm_read_byte(b_map + offset);
+      uint8_t c = pgm_read_byte(c_map + offset);
+      uint8_t d = pgm_read_byte(d_map + offset);
+      return U8Mix(U8Mix(a, b, x << 2), U8Mix(c, d, x << 2), y << 2);
+    }
+
+The node bytes are read from Source/Grids/GridsPatternData.h, which carries
+the firmware's node_0..node_24. The firmware arranges them on the map through
+its own drum_map table; Griddy has always placed node k at column k % 5, row
+k / 5, so drum_map[i][j] below is that layout.
+
+Coordinates are every node and corner of the 5x5 grid (0, 64, 128, 192, 255)
+and the middle of every cell (32, 96, 160, 224), on both axes, for all 32
+steps of all three instruments.
+
+Usage: python3 Tests/generate_grids_golden.py > Tests/GridsGoldenVectors.h
+"""
+
+import os
+import re
+import sys
+
+STEPS_PER_PATTERN = 32
+NUM_INSTRUMENTS = 3
+COORDINATES = [0, 32, 64, 96, 128, 160, 192, 224, 255]
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+PATTERN_DATA = os.path.join(HERE, "..", "Source", "Grids", "GridsPatternData.h")
+
+
+def read_nodes(path):
+    with open(path) as source:
+        text = source.read()
+    nodes = {}
+    for match in re.finditer(r"node_(\d+)\s*=\s*\{([^}]*)\}", text):
+        values = [int(value) for value in re.findall(r"\d+", match.group(2))]
+        if len(values) != STEPS_PER_PATTERN * NUM_INSTRUMENTS:
+            sys.exit("node_%s has %d bytes" % (match.group(1), len(values)))
+        nodes[int(match.group(1))] = values
+    if sorted(nodes) != list(range(25)):
+        sys.exit("expected node_0 to node_24 in %s" % path)
+    return nodes
+
+
+def u8u8_mul(a, b):
+    return (a & 0xFF) * (b & 0xFF)
+
+
+def u8_mix(a, b, balance):
+    word = (u8u8_mul(a, 255 - balance) + u8u8_mul(b, balance)) & 0xFFFF
+    return word >> 8  # sum.bytes[1], the high byte on little-endian AVR
+
+
+def read_drum_map(drum_map, step, instrument, x, y):
+    i = x >> 6
+    j = y >> 6
+    a_map = drum_map(i, j)
+    b_map = drum_map(i + 1, j)
+    c_map = drum_map(i, j + 1)
+    d_map = drum_map(i + 1, j + 1)
+    offset = (instrument * STEPS_PER_PATTERN) + step
+    a, b, c, d = a_map[offset], b_map[offset], c_map[offset], d_map[offset]
+    return u8_mix(u8_mix(a, b, (x << 2) & 0xFF), u8_mix(c, d, (x << 2) & 0xFF), (y << 2) & 0xFF)
+
+
+def main():
+    nodes = read_nodes(PATTERN_DATA)
+    drum_map = lambda i, j: nodes[j * 5 + i]
+
+    out = sys.stdout
+    out.write("#pragma once\n\n")
+    out.write("// Generated by generate_grids_golden.py from the Grids firmware's ReadDrumMap - do not edit\n\n")
+    out.write("#include <array>\n#include <cstdint>\n\n")
+    out.write("namespace GridsGolden {\n\n")
+    out.write("constexpr std::array<uint8_t, %d> kCoordinates { %s };\n\n"
+              % (len(COORDINATES), ", ".join(str(c) for c in COORDINATES)))
+    out.write("// kLevels[yi][xi][instrument * 32 + step] at x = kCoordinates[xi], y = kCoordinates[yi]\n")
+    out.write("constexpr uint8_t kLevels[%d][%d][%d] = {\n"
+              % (len(COORDINATES), len(COORDINATES), STEPS_PER_PATTERN * NUM_INSTRUMENTS))
+    for y in COORDINATES:
+        out.write("    {\n")
+        for x in COORDINATES:
+            levels = [read_drum_map(drum_map, step, instrument, x, y)
+                      for instrument in range(NUM_INSTRUMENTS)
+                      for step in range(STEPS_PER_PATTERN)]
+            out.write("        { // x %d, y %d\n" % (x, y))
+            for row in range(0, len(levels), 16):
+                out.write("            %s,\n" % ", ".join("%3d" % level for level in levels[row:row + 16]))
+            out.write("        },\n")
+        out.write("    },\n")
+    out.write("};\n\n")
+    out.write("} // namespace GridsGolden\n")
+
+
+if __name__ == "__main__":
+    main()